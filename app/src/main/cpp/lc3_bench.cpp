@@ -0,0 +1,126 @@
+// LC3编解码单帧耗时测试（纯C++，不依赖JNI，在主机上运行）
+//
+// 用法：lc3bench [采样率Hz] [码率bps] [音频秒数]
+// 对每种帧长编码、解码同一段合成语音信号，输出每帧耗时与每秒音频的处理耗时，
+// 用于比较短帧（2.5 ms、5 ms）的单帧固定开销。每项测试重复多轮，取最快一轮，
+// 以减小系统调度带来的波动
+
+#include "lib/include/lc3.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+
+// 合成带噪声的浊音信号：基频随时间缓慢变化的谐波叠加
+static void synthesize(std::vector<int16_t>& pcm, int srHz) {
+    uint32_t seed = 1;
+    double phase = 0;
+
+    for (size_t i = 0; i < pcm.size(); i++) {
+        double t = (double)i / srHz;
+        double f0 = 140 + 40 * sin(2 * M_PI * 0.5 * t);
+        phase += 2 * M_PI * f0 / srHz;
+
+        double v = 0;
+        for (int h = 1; h <= 8; h++)
+            v += sin(h * phase) / h;
+
+        seed = seed * 1664525u + 1013904223u;
+        v = 6000 * v + ((int)(seed >> 20) - 2048);
+        pcm[i] = (int16_t)(v > 32767 ? 32767 : v < -32768 ? -32768 : v);
+    }
+}
+
+// 测试轮数
+static const int kPasses = 5;
+
+static double elapsedUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+static int bench(int dtUs, int srHz, int bitrate, int seconds) {
+    int frameSamples = lc3_frame_samples(dtUs, srHz);
+    int frameBytes = lc3_frame_bytes(dtUs, bitrate);
+    unsigned encodeSize = lc3_encoder_size(dtUs, srHz);
+    unsigned decodeSize = lc3_decoder_size(dtUs, srHz);
+    if (frameSamples <= 0 || frameBytes <= 0 || encodeSize == 0 || decodeSize == 0)
+        return -1;
+
+    int frames = (int)((long)seconds * 1000000 / dtUs);
+
+    std::vector<int16_t> pcm((size_t)frames * frameSamples);
+    std::vector<uint8_t> data((size_t)frames * frameBytes);
+    synthesize(pcm, srHz);
+
+    std::vector<int16_t> out(pcm.size());
+    void* encMem = malloc(encodeSize);
+    void* decMem = malloc(decodeSize);
+    double encodeUs = 0, decodeUs = 0;
+    int ret = 0;
+
+    for (int pass = 0; pass < kPasses; pass++) {
+        // 每轮重新初始化，各轮处理完全相同
+        lc3_encoder_t encoder = lc3_setup_encoder(dtUs, srHz, 0, encMem);
+        lc3_decoder_t decoder = lc3_setup_decoder(dtUs, srHz, 0, decMem);
+
+        // 编码全部帧
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; i++)
+            ret |= lc3_encode(encoder, LC3_PCM_FORMAT_S16,
+                              pcm.data() + (size_t)i * frameSamples, 1,
+                              frameBytes, data.data() + (size_t)i * frameBytes);
+        double us = elapsedUs(start);
+        encodeUs = pass == 0 || us < encodeUs ? us : encodeUs;
+
+        // 解码全部帧
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; i++)
+            ret |= lc3_decode(decoder, data.data() + (size_t)i * frameBytes, frameBytes,
+                              LC3_PCM_FORMAT_S16, out.data() + (size_t)i * frameSamples, 1) < 0;
+        us = elapsedUs(start);
+        decodeUs = pass == 0 || us < decodeUs ? us : decodeUs;
+    }
+
+    free(encMem);
+    free(decMem);
+
+    if (ret != 0)
+        return -1;
+
+    printf("%5.1f ms  %4d bytes  encode %7.2f us/frame %6.1f ms/s"
+           "  decode %7.2f us/frame %6.1f ms/s\n",
+           dtUs / 1000.0, frameBytes,
+           encodeUs / frames, encodeUs / 1000 / seconds,
+           decodeUs / frames, decodeUs / 1000 / seconds);
+
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int srHz = argc > 1 ? atoi(argv[1]) : 16000;
+    int bitrate = argc > 2 ? atoi(argv[2]) : 64000;
+    int seconds = argc > 3 ? atoi(argv[3]) : 10;
+
+    if (seconds <= 0) {
+        fprintf(stderr, "usage: %s [sr_hz] [bitrate] [seconds]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%d Hz, %d bps, %d s of audio, best of %d passes\n",
+           srHz, bitrate, seconds, kPasses);
+
+    const int dts[] = { 2500, 5000, 7500, 10000 };
+    for (int dtUs : dts) {
+        if (bench(dtUs, srHz, bitrate, seconds) != 0) {
+            fprintf(stderr, "%d us frames not supported at %d Hz, %d bps\n",
+                    dtUs, srHz, bitrate);
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -253,4 +253,196 @@ Java_com_lh_audiotest03_LC3Codec_releaseDecoder(JNIEnv *env, jobject thiz, jlong
         lc3_decoder_t decoder = (lc3_decoder_t)decoder_handle;
         free(decoder); // 释放解码器内存
     }
-}
\ No newline at end of file
+}
+
+// 多帧编码，PCM数组与输出数组在编码期间通过GetPrimitiveArrayCritical直接访问
+static int encode_frames(JNIEnv *env, jlong encoder_handle, enum lc3_pcm_format fmt,
+                         jarray pcm_buffer, jint frame_samples,
+                         jint frames, jint output_byte_count, jbyteArray output_buffer) {
+    if (encoder_handle == 0 || pcm_buffer == NULL || output_buffer == NULL
+            || frame_samples <= 0 || frames <= 0 || output_byte_count <= 0) {
+        LOGE("Invalid parameters for encode");
+        return -1;
+    }
+
+    lc3_encoder_t encoder = (lc3_encoder_t)encoder_handle;
+
+    // 编码器按自身的帧长读取PCM，以句柄的帧长为准
+    int ns = lc3_encoder_frame_samples(encoder);
+    if (frame_samples != ns) {
+        LOGE("Frame samples %d mismatch the encoder (%d)", frame_samples, ns);
+        return -1;
+    }
+
+    // 检查缓冲区大小，以64位计算避免溢出
+    if (env->GetArrayLength(pcm_buffer) < (jlong)frames * ns
+            || env->GetArrayLength(output_buffer) < (jlong)frames * output_byte_count) {
+        LOGE("Buffer too small for %d frames", frames);
+        return -1;
+    }
+
+    // 批量编码的中间帧存放在堆上的临时缓冲区
+    void* scratch = malloc(lc3_encoder_frames_scratch_size(encoder));
+    if (scratch == NULL) {
+        LOGE("Failed to allocate scratch memory");
+        return -1;
+    }
+
+    // 临界区内不调用其它JNI函数，仅执行编码
+    const uint8_t* pcm_data = (const uint8_t*)env->GetPrimitiveArrayCritical(pcm_buffer, NULL);
+    if (pcm_data == NULL) {
+        free(scratch);
+        LOGE("Failed to get pcm array");
+        return -1;
+    }
+
+    uint8_t* output_data = (uint8_t*)env->GetPrimitiveArrayCritical(output_buffer, NULL);
+    if (output_data == NULL) {
+        env->ReleasePrimitiveArrayCritical(pcm_buffer, (void*)pcm_data, JNI_ABORT);
+        free(scratch);
+        LOGE("Failed to get output array");
+        return -1;
+    }
+
+    // 帧连续存放，按阶段批量编码
+    int result = lc3_encode_frames(encoder, fmt, pcm_data, 1,
+                                   output_byte_count, output_data, frames, scratch);
+
+    env->ReleasePrimitiveArrayCritical(output_buffer, output_data, 0);
+    env->ReleasePrimitiveArrayCritical(pcm_buffer, (void*)pcm_data, JNI_ABORT);
+    free(scratch);
+
+    if (result != 0) {
+        LOGE("LC3 encoding failed with result: %d", result);
+    }
+
+    return result;
+}
+
+// 多帧解码，输入为NULL时对每一帧执行PLC
+static int decode_frames(JNIEnv *env, jlong decoder_handle, jbyteArray input_buffer,
+                         jint input_byte_count, enum lc3_pcm_format fmt, jarray pcm_buffer,
+                         jint frame_samples, jint frames) {
+    if (decoder_handle == 0 || pcm_buffer == NULL || frame_samples <= 0 || frames <= 0
+            || (input_buffer != NULL && input_byte_count <= 0)) {
+        LOGE("Invalid parameters for decode");
+        return -1;
+    }
+
+    lc3_decoder_t decoder = (lc3_decoder_t)decoder_handle;
+
+    // 解码器按自身的帧长写出PCM，以句柄的帧长为准
+    int ns = lc3_decoder_frame_samples(decoder);
+    if (frame_samples != ns) {
+        LOGE("Frame samples %d mismatch the decoder (%d)", frame_samples, ns);
+        return -1;
+    }
+
+    // 检查缓冲区大小，以64位计算避免溢出
+    if ((input_buffer != NULL
+                && env->GetArrayLength(input_buffer) < (jlong)frames * input_byte_count)
+            || env->GetArrayLength(pcm_buffer) < (jlong)frames * ns) {
+        LOGE("Buffer too small for %d frames", frames);
+        return -1;
+    }
+
+    // 批量解码的中间帧存放在堆上的临时缓冲区
+    void* scratch = malloc(lc3_decoder_frames_scratch_size(decoder));
+    if (scratch == NULL) {
+        LOGE("Failed to allocate scratch memory");
+        return -1;
+    }
+
+    const uint8_t* input_data = NULL;
+    if (input_buffer != NULL) {
+        input_data = (const uint8_t*)env->GetPrimitiveArrayCritical(input_buffer, NULL);
+        if (input_data == NULL) {
+            free(scratch);
+            LOGE("Failed to get input array");
+            return -1;
+        }
+    }
+
+    uint8_t* pcm_data = (uint8_t*)env->GetPrimitiveArrayCritical(pcm_buffer, NULL);
+    if (pcm_data == NULL) {
+        if (input_data) env->ReleasePrimitiveArrayCritical(input_buffer, (void*)input_data, JNI_ABORT);
+        free(scratch);
+        LOGE("Failed to get pcm array");
+        return -1;
+    }
+
+    // 帧连续存放，按阶段批量解码，返回值为执行PLC的帧数
+    int result = lc3_decode_frames(decoder, input_data, input_byte_count, fmt,
+                                   pcm_data, 1, frames, scratch);
+    result = result > 0 ? 1 : result;
+
+    env->ReleasePrimitiveArrayCritical(pcm_buffer, pcm_data, 0);
+    if (input_data) env->ReleasePrimitiveArrayCritical(input_buffer, (void*)input_data, JNI_ABORT);
+    free(scratch);
+
+    if (result < 0) {
+        LOGE("LC3 decoding failed with result: %d", result);
+    }
+
+    return result;
+}
+
+// 编码多帧16位PCM（ShortArray）
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Codec_encodeShorts(JNIEnv *env, jobject thiz, jlong encoder_handle,
+                                             jshortArray pcm_buffer, jint frame_samples, jint frames,
+                                             jint output_byte_count, jbyteArray output_buffer) {
+    return encode_frames(env, encoder_handle, LC3_PCM_FORMAT_S16, pcm_buffer,
+                         frame_samples, frames, output_byte_count, output_buffer);
+}
+
+// 编码多帧24位PCM（IntArray，使用低24位）
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Codec_encodeInts(JNIEnv *env, jobject thiz, jlong encoder_handle,
+                                           jintArray pcm_buffer, jint frame_samples, jint frames,
+                                           jint output_byte_count, jbyteArray output_buffer) {
+    return encode_frames(env, encoder_handle, LC3_PCM_FORMAT_S24, pcm_buffer,
+                         frame_samples, frames, output_byte_count, output_buffer);
+}
+
+// 编码多帧浮点PCM（FloatArray，范围-1到1）
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Codec_encodeFloats(JNIEnv *env, jobject thiz, jlong encoder_handle,
+                                             jfloatArray pcm_buffer, jint frame_samples, jint frames,
+                                             jint output_byte_count, jbyteArray output_buffer) {
+    return encode_frames(env, encoder_handle, LC3_PCM_FORMAT_FLOAT, pcm_buffer,
+                         frame_samples, frames, output_byte_count, output_buffer);
+}
+
+// 解码多帧为16位PCM（ShortArray）
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Codec_decodeShorts(JNIEnv *env, jobject thiz, jlong decoder_handle,
+                                             jbyteArray input_buffer, jint input_byte_count,
+                                             jshortArray pcm_buffer, jint frame_samples, jint frames) {
+    return decode_frames(env, decoder_handle, input_buffer, input_byte_count,
+                         LC3_PCM_FORMAT_S16, pcm_buffer, frame_samples, frames);
+}
+
+// 解码多帧为24位PCM（IntArray，符号扩展到32位）
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Codec_decodeInts(JNIEnv *env, jobject thiz, jlong decoder_handle,
+                                           jbyteArray input_buffer, jint input_byte_count,
+                                           jintArray pcm_buffer, jint frame_samples, jint frames) {
+    return decode_frames(env, decoder_handle, input_buffer, input_byte_count,
+                         LC3_PCM_FORMAT_S24, pcm_buffer, frame_samples, frames);
+}
+
+// 解码多帧为浮点PCM（FloatArray）
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Codec_decodeFloats(JNIEnv *env, jobject thiz, jlong decoder_handle,
+                                             jbyteArray input_buffer, jint input_byte_count,
+                                             jfloatArray pcm_buffer, jint frame_samples, jint frames) {
+    return decode_frames(env, decoder_handle, input_buffer, input_byte_count,
+                         LC3_PCM_FORMAT_FLOAT, pcm_buffer, frame_samples, frames);
+}
@@ -0,0 +1,150 @@
+#include "lc3_multi.h"
+
+LC3ChannelWorkers::LC3ChannelWorkers(int channels) {
+    for (int ich = 1; ich < channels; ich++)
+        threads_.emplace_back(&LC3ChannelWorkers::loop, this, ich);
+}
+
+LC3ChannelWorkers::~LC3ChannelWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        cond_.notify_all();
+    }
+
+    for (std::thread& thread : threads_)
+        thread.join();
+}
+
+int LC3ChannelWorkers::run(const std::function<int(int)>& task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        result_ = 0;
+        pending_ = (int)threads_.size();
+        generation_++;
+        cond_.notify_all();
+    }
+
+    int ret = task(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return pending_ == 0; });
+    task_ = NULL;
+    return ret | result_;
+}
+
+void LC3ChannelWorkers::loop(int ich) {
+    unsigned generation = 0;
+
+    for (;;) {
+        const std::function<int(int)>* task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [&] { return closed_ || generation_ != generation; });
+            if (closed_)
+                return;
+
+            generation = generation_;
+            task = task_;
+        }
+
+        // 在锁外处理本声道，各声道状态相互独立
+        int ret = (*task)(ich);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            result_ |= ret;
+            if (--pending_ == 0)
+                cond_.notify_all();
+        }
+    }
+}
+
+LC3MultiEncoder::LC3MultiEncoder(int dtUs, int srHz, int channels, int frameBytes, bool parallel)
+    : lc3::Encoder(dtUs, srHz, 0, channels > 0 ? channels : 0),
+      frameSamples_(GetFrameSamples()),
+      frameBytes_(frameBytes) {
+    valid_ = channels > 0 && frameSamples_ > 0
+        && states.size() == nchannels_
+        && frameBytes >= LC3_MIN_FRAME_BYTES && frameBytes <= LC3_MAX_FRAME_BYTES;
+
+    if (valid_ && parallel && channels > 1)
+        workers_.reset(new LC3ChannelWorkers(channels));
+}
+
+int LC3MultiEncoder::encodeChannel(int ich, const int16_t* pcm, int frames, uint8_t* out) {
+    int nch = (int)nchannels_;
+    int ret = 0;
+
+    for (int i = 0; i < frames; i++) {
+        ret |= lc3_encode(states[ich].get(), LC3_PCM_FORMAT_S16,
+                          pcm + (size_t)i * frameSamples_ * nch + ich, nch,
+                          frameBytes_, out + ((size_t)i * nch + ich) * frameBytes_);
+    }
+
+    return ret;
+}
+
+int LC3MultiEncoder::encode(const int16_t* pcm, int frames, uint8_t* out) {
+    if (!valid_ || frames < 0)
+        return -1;
+
+    int nch = (int)nchannels_;
+
+    if (!workers_) {
+        int ret = 0;
+        for (int i = 0; i < frames; i++)
+            ret |= Encode(pcm + (size_t)i * frameSamples_ * nch,
+                          nch * frameBytes_, out + (size_t)i * nch * frameBytes_);
+        return ret;
+    }
+
+    // 各声道状态相互独立，由常驻线程按声道并行编码，声道0在当前线程编码
+    return workers_->run([&](int ich) { return encodeChannel(ich, pcm, frames, out); });
+}
+
+LC3MultiDecoder::LC3MultiDecoder(int dtUs, int srHz, int channels, int frameBytes, bool parallel)
+    : lc3::Decoder(dtUs, srHz, 0, channels > 0 ? channels : 0),
+      frameSamples_(GetFrameSamples()),
+      frameBytes_(frameBytes) {
+    valid_ = channels > 0 && frameSamples_ > 0
+        && states.size() == nchannels_
+        && frameBytes >= LC3_MIN_FRAME_BYTES && frameBytes <= LC3_MAX_FRAME_BYTES;
+
+    if (valid_ && parallel && channels > 1)
+        workers_.reset(new LC3ChannelWorkers(channels));
+}
+
+int LC3MultiDecoder::decodeChannel(int ich, const uint8_t* in, int frames, int16_t* pcm) {
+    int nch = (int)nchannels_;
+    int ret = 0;
+
+    for (int i = 0; i < frames; i++) {
+        ret |= lc3_decode(states[ich].get(),
+                          in ? in + ((size_t)i * nch + ich) * frameBytes_ : NULL,
+                          frameBytes_, LC3_PCM_FORMAT_S16,
+                          pcm + (size_t)i * frameSamples_ * nch + ich, nch);
+    }
+
+    return ret;
+}
+
+int LC3MultiDecoder::decode(const uint8_t* in, int frames, int16_t* pcm) {
+    if (!valid_ || frames < 0)
+        return -1;
+
+    int nch = (int)nchannels_;
+
+    if (!workers_) {
+        int ret = 0;
+        for (int i = 0; i < frames; i++)
+            ret |= Decode(in ? in + (size_t)i * nch * frameBytes_ : NULL,
+                          in ? nch * frameBytes_ : 0,
+                          pcm + (size_t)i * frameSamples_ * nch);
+        return ret;
+    }
+
+    return workers_->run([&](int ich) { return decodeChannel(ich, in, frames, pcm); });
+}
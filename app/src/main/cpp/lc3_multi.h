@@ -0,0 +1,104 @@
+#ifndef LC3_MULTI_H
+#define LC3_MULTI_H
+
+#include <stdint.h>
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lib/include/lc3_cpp.h"
+
+/**
+ * 按声道并行处理的常驻工作线程
+ *
+ * 为声道1至 channels-1 各创建一个线程，声道0在调用线程上处理。
+ * 线程在创建时启动、析构时退出，每次 run() 只做唤醒与等待。
+ */
+class LC3ChannelWorkers {
+public:
+    explicit LC3ChannelWorkers(int channels);
+    ~LC3ChannelWorkers();
+
+    LC3ChannelWorkers(const LC3ChannelWorkers&) = delete;
+    LC3ChannelWorkers& operator=(const LC3ChannelWorkers&) = delete;
+
+    // 对每个声道调用 task(ich)，返回各声道返回值按位或的结果
+    int run(const std::function<int(int)>& task);
+
+private:
+    void loop(int ich);
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    const std::function<int(int)>* task_ = NULL;
+    unsigned generation_ = 0;
+    int pending_ = 0;
+    int result_ = 0;
+    bool closed_ = false;
+
+    std::vector<std::thread> threads_;
+};
+
+/**
+ * 多声道LC3编码器（基于 lc3_cpp.h 的 lc3::Encoder，纯C++，不依赖JNI）
+ *
+ * 输入为交织的16位PCM（如 WavData.pcmData），一次调用可处理多帧。
+ * 每帧输出 channels 个连续的编码帧，每个声道 frameBytes 字节。
+ * parallel 为true时各声道由常驻工作线程并行编码，适合一次处理多帧的场景。
+ */
+class LC3MultiEncoder : private lc3::Encoder {
+public:
+    LC3MultiEncoder(int dtUs, int srHz, int channels, int frameBytes, bool parallel);
+
+    // 参数非法或内存分配失败时返回false
+    bool valid() const { return valid_; }
+
+    // 编码 frames 帧，返回0表示成功，-1表示失败
+    int encode(const int16_t* pcm, int frames, uint8_t* out);
+
+    int channels() const { return (int)nchannels_; }
+    int frameSamples() const { return frameSamples_; }
+    int frameBytes() const { return frameBytes_; }
+
+private:
+    int encodeChannel(int ich, const int16_t* pcm, int frames, uint8_t* out);
+
+    bool valid_;
+    int frameSamples_;
+    int frameBytes_;
+    std::unique_ptr<LC3ChannelWorkers> workers_;
+};
+
+/**
+ * 多声道LC3解码器（基于 lc3_cpp.h 的 lc3::Decoder）
+ *
+ * 输入布局与 LC3MultiEncoder 的输出一致，输出为交织的16位PCM。
+ */
+class LC3MultiDecoder : private lc3::Decoder {
+public:
+    LC3MultiDecoder(int dtUs, int srHz, int channels, int frameBytes, bool parallel);
+
+    bool valid() const { return valid_; }
+
+    // 解码 frames 帧，in 为NULL时执行PLC
+    // 返回0表示成功，1表示执行了PLC，-1表示失败
+    int decode(const uint8_t* in, int frames, int16_t* pcm);
+
+    int channels() const { return (int)nchannels_; }
+    int frameSamples() const { return frameSamples_; }
+    int frameBytes() const { return frameBytes_; }
+
+private:
+    int decodeChannel(int ich, const uint8_t* in, int frames, int16_t* pcm);
+
+    bool valid_;
+    int frameSamples_;
+    int frameBytes_;
+    std::unique_ptr<LC3ChannelWorkers> workers_;
+};
+
+#endif // LC3_MULTI_H
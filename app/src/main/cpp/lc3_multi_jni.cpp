@@ -0,0 +1,154 @@
+#include "lc3_multi.h"
+#include <jni.h>
+#include <android/log.h>
+
+#define TAG "LC3_MULTI_JNI"
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// 获取每个声道单帧的采样数
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3MultiCodec_getFrameSamples(JNIEnv *env, jobject thiz, jint dt_us, jint sr_hz) {
+    return lc3_frame_samples(dt_us, sr_hz);
+}
+
+// 设置多声道编码器
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_lh_audiotest03_LC3MultiCodec_setupEncoder(JNIEnv *env, jobject thiz, jint dt_us, jint sr_hz,
+                                                  jint channels, jint frame_bytes, jboolean parallel) {
+    LC3MultiEncoder* encoder = new LC3MultiEncoder(dt_us, sr_hz, channels, frame_bytes, parallel);
+    if (!encoder->valid()) {
+        LOGE("Invalid encoder parameters: dt_us=%d, sr_hz=%d, channels=%d, frame_bytes=%d",
+             dt_us, sr_hz, channels, frame_bytes);
+        delete encoder;
+        return 0;
+    }
+
+    return (jlong)encoder;
+}
+
+// 设置多声道解码器
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_lh_audiotest03_LC3MultiCodec_setupDecoder(JNIEnv *env, jobject thiz, jint dt_us, jint sr_hz,
+                                                  jint channels, jint frame_bytes, jboolean parallel) {
+    LC3MultiDecoder* decoder = new LC3MultiDecoder(dt_us, sr_hz, channels, frame_bytes, parallel);
+    if (!decoder->valid()) {
+        LOGE("Invalid decoder parameters: dt_us=%d, sr_hz=%d, channels=%d, frame_bytes=%d",
+             dt_us, sr_hz, channels, frame_bytes);
+        delete decoder;
+        return 0;
+    }
+
+    return (jlong)decoder;
+}
+
+// 编码多帧交织PCM数据
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3MultiCodec_encode(JNIEnv *env, jobject thiz, jlong encoder_handle,
+                                            jbyteArray input_buffer, jbyteArray output_buffer,
+                                            jint frames) {
+    if (encoder_handle == 0 || input_buffer == NULL || output_buffer == NULL || frames <= 0) {
+        LOGE("Invalid parameters for encode");
+        return -1;
+    }
+
+    LC3MultiEncoder* encoder = (LC3MultiEncoder*)encoder_handle;
+
+    // 检查缓冲区大小
+    jlong input_size = (jlong)frames * encoder->frameSamples() * encoder->channels() * 2;
+    jlong output_size = (jlong)frames * encoder->channels() * encoder->frameBytes();
+    if ((jlong)env->GetArrayLength(input_buffer) < input_size
+            || (jlong)env->GetArrayLength(output_buffer) < output_size) {
+        LOGE("Buffer too small for %d frames", frames);
+        return -1;
+    }
+
+    jbyte* input_data = env->GetByteArrayElements(input_buffer, NULL);
+    jbyte* output_data = env->GetByteArrayElements(output_buffer, NULL);
+
+    if (input_data == NULL || output_data == NULL) {
+        LOGE("Failed to get byte array elements");
+        if (input_data) env->ReleaseByteArrayElements(input_buffer, input_data, JNI_ABORT);
+        if (output_data) env->ReleaseByteArrayElements(output_buffer, output_data, JNI_ABORT);
+        return -1;
+    }
+
+    int result = encoder->encode((const int16_t*)input_data, frames, (uint8_t*)output_data);
+    if (result != 0) {
+        LOGE("LC3 multi-channel encoding failed with result: %d", result);
+    }
+
+    env->ReleaseByteArrayElements(input_buffer, input_data, JNI_ABORT);
+    env->ReleaseByteArrayElements(output_buffer, output_data, 0);
+
+    return result;
+}
+
+// 解码多帧数据为交织PCM，输入为NULL时执行PLC
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3MultiCodec_decode(JNIEnv *env, jobject thiz, jlong decoder_handle,
+                                            jbyteArray input_buffer, jbyteArray output_buffer,
+                                            jint frames) {
+    if (decoder_handle == 0 || output_buffer == NULL || frames <= 0) {
+        LOGE("Invalid parameters for decode");
+        return -1;
+    }
+
+    LC3MultiDecoder* decoder = (LC3MultiDecoder*)decoder_handle;
+
+    // 检查缓冲区大小
+    jlong input_size = (jlong)frames * decoder->channels() * decoder->frameBytes();
+    jlong output_size = (jlong)frames * decoder->frameSamples() * decoder->channels() * 2;
+    if ((input_buffer != NULL && (jlong)env->GetArrayLength(input_buffer) < input_size)
+            || (jlong)env->GetArrayLength(output_buffer) < output_size) {
+        LOGE("Buffer too small for %d frames", frames);
+        return -1;
+    }
+
+    jbyte* input_data = NULL;
+    if (input_buffer != NULL) {
+        input_data = env->GetByteArrayElements(input_buffer, NULL);
+        if (input_data == NULL) {
+            LOGE("Failed to get input byte array elements");
+            return -1;
+        }
+    }
+
+    jbyte* output_data = env->GetByteArrayElements(output_buffer, NULL);
+    if (output_data == NULL) {
+        LOGE("Failed to get output byte array elements");
+        if (input_data) env->ReleaseByteArrayElements(input_buffer, input_data, JNI_ABORT);
+        return -1;
+    }
+
+    int result = decoder->decode((const uint8_t*)input_data, frames, (int16_t*)output_data);
+    if (result < 0) {
+        LOGE("LC3 multi-channel decoding failed with result: %d", result);
+    } else if (result == 1) {
+        LOGD("LC3 multi-channel decoding performed PLC");
+    }
+
+    if (input_data) env->ReleaseByteArrayElements(input_buffer, input_data, JNI_ABORT);
+    env->ReleaseByteArrayElements(output_buffer, output_data, 0);
+
+    return result;
+}
+
+// 释放多声道编码器
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_lh_audiotest03_LC3MultiCodec_releaseEncoder(JNIEnv *env, jobject thiz, jlong encoder_handle) {
+    delete (LC3MultiEncoder*)encoder_handle;
+}
+
+// 释放多声道解码器
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_lh_audiotest03_LC3MultiCodec_releaseDecoder(JNIEnv *env, jobject thiz, jlong decoder_handle) {
+    delete (LC3MultiDecoder*)decoder_handle;
+}
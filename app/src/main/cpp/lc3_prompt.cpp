@@ -0,0 +1,143 @@
+#include "lc3_prompt.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+LC3Prompt* LC3Prompt::create(int dtUs, int srHz, int frameBytes,
+                             const int16_t* pcm, int samples) {
+    int frameSamples = lc3_frame_samples(dtUs, srHz);
+    unsigned encodeSize = lc3_encoder_size(dtUs, srHz);
+    if (frameSamples <= 0 || encodeSize == 0)
+        return NULL;
+
+    if (frameBytes < LC3_MIN_FRAME_BYTES || frameBytes > LC3_MAX_FRAME_BYTES
+            || pcm == NULL || samples <= 0)
+        return NULL;
+
+    void* encMem = malloc(encodeSize);
+    if (encMem == NULL)
+        return NULL;
+
+    lc3_encoder_t encoder = lc3_setup_encoder(dtUs, srHz, 0, encMem);
+    if (encoder == NULL) {
+        free(encMem);
+        return NULL;
+    }
+
+    int frames = (samples + frameSamples - 1) / frameSamples;
+    LC3Prompt* prompt = new LC3Prompt(dtUs, srHz, frameSamples, frameBytes, frames);
+
+    // 最后一个不完整的帧以静音补齐
+    std::vector<int16_t> last(frameSamples, 0);
+    int ret = 0;
+
+    for (int i = 0; i < frames; i++) {
+        const int16_t* in = pcm + (size_t)i * frameSamples;
+        int n = samples - i * frameSamples;
+        if (n < frameSamples) {
+            memcpy(last.data(), in, n * sizeof(int16_t));
+            in = last.data();
+        }
+
+        if (i == 0)
+            memcpy(prompt->head_.data(), in, frameSamples * sizeof(int16_t));
+
+        ret |= lc3_encode(encoder, LC3_PCM_FORMAT_S16, in, 1,
+                          frameBytes, prompt->data_.data() + (size_t)i * frameBytes);
+    }
+
+    // 编码器状态不含指向自身内存的指针，可按字节复制
+    prompt->state_.assign((const uint8_t*)encMem, (const uint8_t*)encMem + encodeSize);
+    free(encMem);
+
+    if (ret != 0) {
+        delete prompt;
+        return NULL;
+    }
+
+    return prompt;
+}
+
+LC3Prompt::LC3Prompt(int dtUs, int srHz, int frameSamples, int frameBytes, int frames)
+    : dtUs_(dtUs),
+      srHz_(srHz),
+      frameSamples_(frameSamples),
+      frameBytes_(frameBytes),
+      frames_(frames),
+      data_((size_t)frames * frameBytes),
+      head_(frameSamples) {
+}
+
+LC3SpliceEncoder::LC3SpliceEncoder(int dtUs, int srHz, int frameBytes)
+    : dtUs_(dtUs),
+      srHz_(srHz),
+      frameSamples_(lc3_frame_samples(dtUs, srHz)),
+      frameBytes_(frameBytes) {
+    unsigned encodeSize = lc3_encoder_size(dtUs, srHz);
+    if (frameSamples_ <= 0 || encodeSize == 0
+            || frameBytes < LC3_MIN_FRAME_BYTES || frameBytes > LC3_MAX_FRAME_BYTES)
+        return;
+
+    encoderMem_ = malloc(encodeSize);
+    if (encoderMem_ == NULL)
+        return;
+
+    encoder_ = lc3_setup_encoder(dtUs, srHz, 0, encoderMem_);
+    encoderSize_ = encodeSize;
+    mix_.resize(frameSamples_);
+}
+
+LC3SpliceEncoder::~LC3SpliceEncoder() {
+    free(encoderMem_);
+}
+
+bool LC3SpliceEncoder::splice(const LC3Prompt* prompt) {
+    if (encoder_ == NULL || prompt == NULL || prompt_ != NULL
+            || !prompt->matches(dtUs_, srHz_, frameBytes_)
+            || prompt->stateSize() != encoderSize_)
+        return false;
+
+    prompt_ = prompt;
+    position_ = 0;
+    return true;
+}
+
+int LC3SpliceEncoder::encode(const int16_t* pcm, uint8_t* out) {
+    if (encoder_ == NULL || out == NULL)
+        return -1;
+
+    if (prompt_ == NULL) {
+        if (pcm != NULL)
+            return lc3_encode(encoder_, LC3_PCM_FORMAT_S16, pcm, 1, frameBytes_, out);
+
+        memset(mix_.data(), 0, frameSamples_ * sizeof(int16_t));
+        return lc3_encode(encoder_, LC3_PCM_FORMAT_S16, mix_.data(), 1, frameBytes_, out);
+    }
+
+    int ret = 0;
+
+    if (position_ == 0) {
+        // 片段首帧实时编码：前半帧内由直播PCM线性过渡到片段PCM，
+        // 后半帧（与下一帧的重叠部分）与预编码时的输入一致
+        const int16_t* head = prompt_->head();
+        int ramp = frameSamples_ / 2;
+
+        for (int i = 0; i < frameSamples_; i++) {
+            int live = pcm != NULL ? pcm[i] : 0;
+            mix_[i] = i < ramp ? (int16_t)(live + (head[i] - live) * i / ramp) : head[i];
+        }
+
+        ret = lc3_encode(encoder_, LC3_PCM_FORMAT_S16, mix_.data(), 1, frameBytes_, out);
+    } else {
+        memcpy(out, prompt_->frame(position_), frameBytes_);
+    }
+
+    // 片段结束：复制片段的编码器状态，之后的直播帧与片段尾帧衔接
+    if (++position_ == prompt_->frames()) {
+        if (position_ > 1)
+            memcpy(encoderMem_, prompt_->state(), encoderSize_);
+        prompt_ = NULL;
+    }
+
+    return ret;
+}
@@ -0,0 +1,118 @@
+#ifndef LC3_PROMPT_H
+#define LC3_PROMPT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <vector>
+
+#include "lib/include/lc3.h"
+
+/**
+ * 预编码的提示音片段（等待音乐、语音提示、信令音等，16位单声道PCM）
+ *
+ * 创建时一次性编码整个片段，之后可被任意多个 LC3SpliceEncoder 共享，
+ * 插入到各自的输出流中而无需重新编码。片段不足一帧的尾部以静音补齐。
+ *
+ * 除编码帧外还保存：
+ * - 首帧PCM，插入时由实时编码器编码，与直播PCM交叉淡入；
+ * - 编码完最后一帧后的编码器状态，插入结束时复制到实时编码器，
+ *   使其后的直播帧与片段尾帧在解码端无缝衔接（MDCT重叠部分一致）。
+ */
+class LC3Prompt {
+public:
+    /**
+     * 编码PCM片段，参数非法或内存不足时返回NULL
+     * @param dtUs 帧长（微秒）
+     * @param srHz 采样率（Hz）
+     * @param frameBytes 编码后每帧的字节数，须与插入的流一致
+     * @param pcm 片段PCM
+     * @param samples 片段采样数
+     */
+    static LC3Prompt* create(int dtUs, int srHz, int frameBytes,
+                             const int16_t* pcm, int samples);
+
+    int frames() const { return frames_; }
+    int frameSamples() const { return frameSamples_; }
+    int frameBytes() const { return frameBytes_; }
+
+    // 第 index 帧的编码数据
+    const uint8_t* frame(int index) const { return data_.data() + (size_t)index * frameBytes_; }
+
+    // 首帧PCM
+    const int16_t* head() const { return head_.data(); }
+
+    // 编码完最后一帧后的编码器状态
+    const void* state() const { return state_.data(); }
+    size_t stateSize() const { return state_.size(); }
+
+    // 编码配置是否与 dtUs、srHz、frameBytes 一致
+    bool matches(int dtUs, int srHz, int frameBytes) const {
+        return dtUs == dtUs_ && srHz == srHz_ && frameBytes == frameBytes_;
+    }
+
+private:
+    LC3Prompt(int dtUs, int srHz, int frameSamples, int frameBytes, int frames);
+
+    int dtUs_;
+    int srHz_;
+    int frameSamples_;
+    int frameBytes_;
+    int frames_;
+
+    std::vector<uint8_t> data_;
+    std::vector<int16_t> head_;
+    std::vector<uint8_t> state_;
+};
+
+/**
+ * 支持插入预编码片段的LC3实时编码器（16位单声道PCM）
+ *
+ * 平时逐帧编码调用方提供的直播PCM；splice() 之后的帧改为输出片段：
+ * - 片段首帧由本编码器实时编码，前半帧内从直播PCM线性过渡到片段PCM，
+ *   使解码端的重叠相加不出现断点；
+ * - 其余帧直接复制预编码数据，此期间的直播PCM被丢弃；
+ * - 片段结束时将片段的编码器状态复制到本编码器，随后恢复直播编码。
+ *
+ * 每次插入只实时编码一帧，其余编码开销均由预编码承担。
+ * 片段对象须在插入结束前保持有效。
+ */
+class LC3SpliceEncoder {
+public:
+    LC3SpliceEncoder(int dtUs, int srHz, int frameBytes);
+    ~LC3SpliceEncoder();
+
+    LC3SpliceEncoder(const LC3SpliceEncoder&) = delete;
+    LC3SpliceEncoder& operator=(const LC3SpliceEncoder&) = delete;
+
+    // 参数非法或内存分配失败时返回false
+    bool valid() const { return encoder_ != NULL; }
+
+    // 从下一帧开始插入片段；配置不一致或已有片段正在插入时返回false
+    bool splice(const LC3Prompt* prompt);
+
+    // 是否正在输出片段
+    bool splicing() const { return prompt_ != NULL; }
+
+    // 编码一帧，pcm 为NULL时按静音处理；返回0表示成功，-1表示失败
+    int encode(const int16_t* pcm, uint8_t* out);
+
+    int frameSamples() const { return frameSamples_; }
+    int frameBytes() const { return frameBytes_; }
+
+private:
+    int dtUs_;
+    int srHz_;
+    int frameSamples_;
+    int frameBytes_;
+
+    lc3_encoder_t encoder_ = NULL;
+    void* encoderMem_ = NULL;
+    size_t encoderSize_ = 0;
+
+    const LC3Prompt* prompt_ = NULL;
+    int position_ = 0;
+    std::vector<int16_t> mix_;
+};
+
+#endif // LC3_PROMPT_H
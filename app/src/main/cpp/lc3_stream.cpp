@@ -0,0 +1,155 @@
+#include "lc3_stream.h"
+
+#include <stdlib.h>
+
+LC3StreamEncoder* LC3StreamEncoder::create(int dtUs, int srHz, int frameBytes,
+                                           int poolSize, int batchFrames) {
+    int frameSamples = lc3_frame_samples(dtUs, srHz);
+    unsigned encodeSize = lc3_encoder_size(dtUs, srHz);
+    if (frameSamples <= 0 || encodeSize == 0)
+        return NULL;
+
+    if (frameBytes < LC3_MIN_FRAME_BYTES || frameBytes > LC3_MAX_FRAME_BYTES
+            || poolSize < 2 || batchFrames < 1)
+        return NULL;
+
+    void* encMem = malloc(encodeSize);
+    if (encMem == NULL)
+        return NULL;
+
+    lc3_encoder_t encoder = lc3_setup_encoder(dtUs, srHz, 0, encMem);
+    if (encoder == NULL) {
+        free(encMem);
+        return NULL;
+    }
+
+    LC3StreamEncoder* stream =
+            new LC3StreamEncoder(frameSamples, frameBytes, poolSize, batchFrames);
+    stream->encoder_ = encoder;
+    stream->encoderMem_ = encMem;
+    stream->worker_ = std::thread(&LC3StreamEncoder::run, stream);
+
+    return stream;
+}
+
+LC3StreamEncoder::LC3StreamEncoder(int frameSamples, int frameBytes,
+                                   int poolSize, int batchFrames)
+    : frameSamples_(frameSamples),
+      frameBytes_(frameBytes),
+      batchFrames_(batchFrames),
+      pcm_((size_t)poolSize * batchFrames * frameSamples),
+      out_((size_t)poolSize * batchFrames * frameBytes),
+      blocks_(poolSize) {
+    for (int i = 0; i < poolSize; i++)
+        free_.push_back(i);
+}
+
+LC3StreamEncoder::~LC3StreamEncoder() {
+    close();
+    if (worker_.joinable())
+        worker_.join();
+    free(encoderMem_);
+}
+
+int LC3StreamEncoder::acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return closed_ || !free_.empty(); });
+    if (closed_)
+        return -1;
+
+    int index = free_.front();
+    free_.pop_front();
+    return index;
+}
+
+bool LC3StreamEncoder::submit(int index, int frames) {
+    if (index < 0 || index >= poolSize() || frames < 0 || frames > batchFrames_)
+        return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_ || finished_)
+        return false;
+
+    blocks_[index].frames = frames;
+    blocks_[index].result = 0;
+    if (frames > 0)
+        pending_.push_back(index);
+    else
+        free_.push_back(index);
+
+    cond_.notify_all();
+    return true;
+}
+
+void LC3StreamEncoder::finish() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = true;
+    cond_.notify_all();
+}
+
+int LC3StreamEncoder::take() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] {
+        return closed_ || !done_.empty()
+            || (finished_ && pending_.empty() && !busy_); });
+    if (closed_ || done_.empty())
+        return -1;
+
+    int index = done_.front();
+    done_.pop_front();
+    return index;
+}
+
+void LC3StreamEncoder::release(int index) {
+    if (index < 0 || index >= poolSize())
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(index);
+    cond_.notify_all();
+}
+
+void LC3StreamEncoder::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    cond_.notify_all();
+}
+
+void LC3StreamEncoder::run() {
+    for (;;) {
+        int index;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this] {
+                return closed_ || !pending_.empty() || finished_; });
+            if (closed_ || pending_.empty())
+                return;
+
+            index = pending_.front();
+            pending_.pop_front();
+            busy_ = true;
+        }
+
+        // 在锁外编码整个缓冲块，调用方可同时填充其它缓冲块
+        Block& block = blocks_[index];
+        const int16_t* in = pcm(index);
+        uint8_t* out = output(index);
+
+        for (int i = 0; i < block.frames; i++) {
+            int ret = lc3_encode(encoder_, LC3_PCM_FORMAT_S16, in, 1, frameBytes_, out);
+            if (ret != 0 && block.result == 0)
+                block.result = ret;
+
+            in += frameSamples_;
+            out += frameBytes_;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_.push_back(index);
+            busy_ = false;
+            cond_.notify_all();
+        }
+    }
+}
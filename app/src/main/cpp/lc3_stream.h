@@ -0,0 +1,103 @@
+#ifndef LC3_STREAM_H
+#define LC3_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lib/include/lc3.h"
+
+/**
+ * LC3流式编码器（纯C++，不依赖JNI，可在Linux上直接测试）
+ *
+ * 内部维护一个固定大小的缓冲块池，每个缓冲块可容纳 batchFrames 帧
+ * 16位单声道PCM以及对应的编码输出。调用方的使用流程：
+ *
+ *   acquire() -> 向 pcm(index) 写入PCM -> submit(index, frames)
+ *   take()    -> 从 output(index) 读取编码结果 -> release(index)
+ *
+ * 编码在专用的工作线程上进行，acquire()/take() 在无可用缓冲块时阻塞。
+ * 缓冲块内存在创建时一次性分配，之后不再分配内存。
+ */
+class LC3StreamEncoder {
+public:
+    /**
+     * 创建流式编码器，参数非法或内存不足时返回NULL
+     * @param dtUs 帧长（微秒）
+     * @param srHz 采样率（Hz）
+     * @param frameBytes 编码后每帧的字节数
+     * @param poolSize 缓冲块个数（至少为2，以便填充与编码并行）
+     * @param batchFrames 每个缓冲块包含的帧数
+     */
+    static LC3StreamEncoder* create(int dtUs, int srHz, int frameBytes,
+                                    int poolSize, int batchFrames);
+
+    ~LC3StreamEncoder();
+
+    // 获取一个空闲缓冲块，返回缓冲块编号；流已关闭时返回-1
+    int acquire();
+
+    // 提交缓冲块中的 frames 帧进行编码，frames 为0时直接归还缓冲块
+    bool submit(int index, int frames);
+
+    // 标记输入结束，工作线程处理完剩余的缓冲块后 take() 返回-1
+    void finish();
+
+    // 获取一个已编码完成的缓冲块，返回缓冲块编号；全部完成或流已关闭时返回-1
+    int take();
+
+    // 归还由 take() 获取的缓冲块
+    void release(int index);
+
+    // 关闭流并唤醒所有阻塞的调用，未处理的数据被丢弃
+    void close();
+
+    int16_t* pcm(int index) { return pcm_.data() + (size_t)index * batchFrames_ * frameSamples_; }
+    uint8_t* output(int index) { return out_.data() + (size_t)index * batchFrames_ * frameBytes_; }
+
+    // 缓冲块中的有效帧数，以及编码结果（0表示全部成功，否则为首个失败帧的返回值）
+    int frames(int index) const { return blocks_[index].frames; }
+    int result(int index) const { return blocks_[index].result; }
+
+    int poolSize() const { return (int)blocks_.size(); }
+    int batchFrames() const { return batchFrames_; }
+    int frameSamples() const { return frameSamples_; }
+    int frameBytes() const { return frameBytes_; }
+
+private:
+    LC3StreamEncoder(int frameSamples, int frameBytes, int poolSize, int batchFrames);
+
+    void run();
+
+    struct Block {
+        int frames;
+        int result;
+    };
+
+    lc3_encoder_t encoder_ = NULL;
+    void* encoderMem_ = NULL;
+
+    int frameSamples_;
+    int frameBytes_;
+    int batchFrames_;
+
+    std::vector<int16_t> pcm_;
+    std::vector<uint8_t> out_;
+    std::vector<Block> blocks_;
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<int> free_, pending_, done_;
+    bool busy_ = false;
+    bool finished_ = false;
+    bool closed_ = false;
+
+    std::thread worker_;
+};
+
+#endif // LC3_STREAM_H
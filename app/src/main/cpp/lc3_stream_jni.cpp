@@ -0,0 +1,119 @@
+#include "lc3_stream.h"
+#include <jni.h>
+#include <android/log.h>
+
+#define TAG "LC3_STREAM_JNI"
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// 创建流式编码器
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeCreate(JNIEnv *env, jobject thiz, jint dt_us, jint sr_hz,
+                                              jint frame_bytes, jint pool_size, jint batch_frames) {
+    LC3StreamEncoder* stream = LC3StreamEncoder::create(
+            dt_us, sr_hz, frame_bytes, pool_size, batch_frames);
+    if (stream == NULL) {
+        LOGE("Failed to create stream encoder: dt_us=%d, sr_hz=%d, frame_bytes=%d, pool=%d, batch=%d",
+             dt_us, sr_hz, frame_bytes, pool_size, batch_frames);
+        return 0;
+    }
+
+    LOGD("Stream encoder created: pool=%d, batch=%d", pool_size, batch_frames);
+    return (jlong)stream;
+}
+
+// 获取缓冲块的PCM直接缓冲区（与native内存共享，不拷贝）
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativePcmBuffer(JNIEnv *env, jobject thiz, jlong handle, jint index) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    if (stream == NULL || index < 0 || index >= stream->poolSize())
+        return NULL;
+
+    jlong capacity = (jlong)stream->batchFrames() * stream->frameSamples() * sizeof(int16_t);
+    return env->NewDirectByteBuffer(stream->pcm(index), capacity);
+}
+
+// 获取缓冲块的编码输出直接缓冲区（与native内存共享，不拷贝）
+extern "C"
+JNIEXPORT jobject JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeOutputBuffer(JNIEnv *env, jobject thiz, jlong handle, jint index) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    if (stream == NULL || index < 0 || index >= stream->poolSize())
+        return NULL;
+
+    jlong capacity = (jlong)stream->batchFrames() * stream->frameBytes();
+    return env->NewDirectByteBuffer(stream->output(index), capacity);
+}
+
+// 获取空闲缓冲块（阻塞）
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeAcquire(JNIEnv *env, jobject thiz, jlong handle) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    return stream ? stream->acquire() : -1;
+}
+
+// 提交缓冲块进行编码
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeSubmit(JNIEnv *env, jobject thiz, jlong handle,
+                                              jint index, jint frames) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    return stream && stream->submit(index, frames) ? JNI_TRUE : JNI_FALSE;
+}
+
+// 标记输入结束
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeFinish(JNIEnv *env, jobject thiz, jlong handle) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    if (stream) stream->finish();
+}
+
+// 获取已编码完成的缓冲块（阻塞）
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeTake(JNIEnv *env, jobject thiz, jlong handle) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    return stream ? stream->take() : -1;
+}
+
+// 缓冲块中的有效帧数
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeFrames(JNIEnv *env, jobject thiz, jlong handle, jint index) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    if (stream == NULL || index < 0 || index >= stream->poolSize())
+        return 0;
+
+    if (stream->result(index) != 0)
+        LOGE("Stream encoding failed with result: %d", stream->result(index));
+
+    return stream->frames(index);
+}
+
+// 归还缓冲块
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeRelease(JNIEnv *env, jobject thiz, jlong handle, jint index) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    if (stream) stream->release(index);
+}
+
+// 关闭流，唤醒阻塞中的 acquire/take
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeClose(JNIEnv *env, jobject thiz, jlong handle) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    if (stream) stream->close();
+}
+
+// 销毁流式编码器，等待工作线程退出
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_lh_audiotest03_LC3Stream_nativeDestroy(JNIEnv *env, jobject thiz, jlong handle) {
+    LC3StreamEncoder* stream = (LC3StreamEncoder*)handle;
+    delete stream;
+}
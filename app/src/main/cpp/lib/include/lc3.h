@@ -143,6 +143,9 @@
  *   - A NULL memory adress as input, will return a NULL encoder context.
  *   - The returned encoder handle is set at the address of the allocated
  *     memory space, you can directly free the handle.
+ *   - The context holds no pointer into its own memory space, a byte copy
+ *     of the `lc3_xxcoder_size()` bytes is a valid context, that continues
+ *     from the same point as the original one.
  *
  * Next, call the `lc3_encode()` encoding procedure, for each frames.
  * To handle multichannel streams (Stereo or more), you can proceed with
@@ -231,6 +234,42 @@ enum lc3_pcm_format {
 };
 
 
+/**
+ * Analysis output of an encoded frame
+ *   spectrum        MDCT coefficients of the frame, before the spectral
+ *                   shaping, in a buffer of `lc3_hr_frame_samples()`
+ *                   values at the encoded samplerate, or NULL.
+ *   nbands          Number of bands of `energies`
+ *   energies        Mean energy of the coefficients by band
+ *   attack          An attack has been detected
+ *   bandwidth_hz    Detected audio bandwidth
+ *   pitch_present   A pitch has been detected, given by `pitch_hz`
+ *   correlation     Normalized correlation at the pitch, 0 when not present
+ *   level_db        Level of the frame, in dB relative to full scale
+ *   vad             Voice activity decision
+ *
+ * The spectrum and energies use the scale of 16 bits samples.
+ * The voice activity is tracked over the frames analyzed.
+ */
+
+#define LC3_MAX_ANALYSIS_BANDS  64
+
+struct lc3_frame_analysis {
+    float *spectrum;
+
+    int nbands;
+    float energies[LC3_MAX_ANALYSIS_BANDS];
+
+    bool attack;
+    int bandwidth_hz;
+    bool pitch_present;
+    float pitch_hz, correlation;
+
+    float level_db;
+    bool vad;
+};
+
+
 /**
  * Handle
  */
@@ -355,6 +394,20 @@ LC3_EXPORT lc3_encoder_t lc3_hr_setup_encoder(
 LC3_EXPORT lc3_encoder_t lc3_setup_encoder(
     int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
 
+/**
+ * Return the number of PCM samples of a frame taken by an encoder
+ * encoder         Handle of the encoder
+ * return          Number of PCM samples, -1 on bad parameters
+ */
+LC3_EXPORT int lc3_encoder_frame_samples(lc3_encoder_t encoder);
+
+/**
+ * Return the size of the scratch buffer of `lc3_encode_frames()`
+ * encoder         Handle of the encoder
+ * return          Size of the scratch buffer in bytes, 0 on bad parameters
+ */
+LC3_EXPORT unsigned lc3_encoder_frames_scratch_size(lc3_encoder_t encoder);
+
 /**
  * Encode a frame
  * encoder         Handle of the encoder
@@ -368,6 +421,49 @@ LC3_EXPORT int lc3_encode(
     lc3_encoder_t encoder, enum lc3_pcm_format fmt,
     const void *pcm, int stride, int nbytes, void *out);
 
+/**
+ * Encode a frame, and return its analysis
+ * encoder         Handle of the encoder
+ * fmt             PCM input format
+ * pcm, stride     Input PCM samples, and count between two consecutives
+ * nbytes          Target size, in bytes, of the frame
+ * out             Output buffer of `nbytes` size
+ * analysis        Return the analysis of the frame, or NULL
+ * return          0: On success  -1: Wrong parameters
+ *
+ * The encoded frame is the same as given by `lc3_encode()`, the analysis
+ * takes its values from the encoding, and adds a cheap voice activity
+ * detection.
+ */
+LC3_EXPORT int lc3_encode_analysis(
+    lc3_encoder_t encoder, enum lc3_pcm_format fmt,
+    const void *pcm, int stride, int nbytes, void *out,
+    struct lc3_frame_analysis *analysis);
+
+/**
+ * Encode a sequence of frames
+ * encoder         Handle of the encoder
+ * fmt             PCM input format
+ * pcm, stride     Input PCM samples, and count between two consecutives
+ * nbytes          Target size, in bytes, of each frame
+ * out             Output buffer of `nframes * nbytes` size
+ * nframes         Number of frames to encode
+ * scratch         Scratch buffer of `lc3_encoder_frames_scratch_size()`
+ *                 bytes, aligned to pointer type
+ * return          0: On success  -1: Wrong parameters
+ *
+ * The frames follow each others in `pcm`, spaced by the number of samples
+ * of a frame times `stride`, and in `out`, spaced by `nbytes`. The output
+ * is the same as encoding the frames one by one with `lc3_encode()`,
+ * the processing is done stage by stage on blocks of frames, for offline
+ * jobs. The frames of a block are kept in the scratch buffer, the stack
+ * usage is the one of `lc3_encode()`.
+ */
+LC3_EXPORT int lc3_encode_frames(
+    lc3_encoder_t encoder, enum lc3_pcm_format fmt,
+    const void *pcm, int stride, int nbytes, void *out, int nframes,
+    void *scratch);
+
 /**
  * Return size needed for an decoder
  * hrmode          Enable High-Resolution mode (48000 and 96000 sample rates)
@@ -403,6 +499,20 @@ LC3_EXPORT lc3_decoder_t lc3_hr_setup_decoder(
 LC3_EXPORT lc3_decoder_t lc3_setup_decoder(
     int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
 
+/**
+ * Return the number of PCM samples of a frame output by a decoder
+ * decoder         Handle of the decoder
+ * return          Number of PCM samples, -1 on bad parameters
+ */
+LC3_EXPORT int lc3_decoder_frame_samples(lc3_decoder_t decoder);
+
+/**
+ * Return the size of the scratch buffer of `lc3_decode_frames()`
+ * decoder         Handle of the decoder
+ * return          Size of the scratch buffer in bytes, 0 on bad parameters
+ */
+LC3_EXPORT unsigned lc3_decoder_frames_scratch_size(lc3_decoder_t decoder);
+
 /**
  * Decode a frame
  * decoder         Handle of the decoder
@@ -415,6 +525,90 @@ LC3_EXPORT int lc3_decode(
     lc3_decoder_t decoder, const void *in, int nbytes,
     enum lc3_pcm_format fmt, void *pcm, int stride);
 
+/**
+ * Decode a frame, adjusting its duration for adaptive playout
+ * decoder         Handle of the decoder
+ * in, nbytes      Input bitstream, and size in bytes, NULL performs PLC
+ * fmt             PCM output format
+ * pcm, stride     Output PCM samples, and count between two consecutives
+ * adjust          < 0: Shorten the frame  > 0: Lengthen it  0: Regular frame
+ * nout            Return the count of samples output
+ * return          0: On success  1: PLC operated  -1: Wrong parameters
+ *
+ * A voiced frame is adjusted by whole periods of the pitch transmitted with
+ * the LTPF data, up to half a frame when the period allows it, crossfading
+ * the frame with its copy shifted by these periods. Other frames are
+ * adjusted by half a frame. Lengthening uses the past output, and is done
+ * for a shift up to a frame, shortening up to 3/4 of a frame, otherwise
+ * the frame is left as is. In high-resolution mode at 96 KHz, the decoder
+ * keeps no past output, and the frames are never lengthened. The decoder
+ * state does not depend on the adjustment, the next frames follow
+ * seamlessly. The output buffer must hold up to twice the samples
+ * of a frame.
+ */
+LC3_EXPORT int lc3_decode_adaptive(
+    lc3_decoder_t decoder, const void *in, int nbytes,
+    enum lc3_pcm_format fmt, void *pcm, int stride, int adjust, int *nout);
+
+/**
+ * Decode a sequence of frames
+ * decoder         Handle of the decoder
+ * in, nbytes      Input bitstreams, and size in bytes of each frame,
+ *                 NULL performs PLC
+ * fmt             PCM output format
+ * pcm, stride     Output PCM samples, and count between two consecutives
+ * nframes         Number of frames to decode
+ * scratch         Scratch buffer of `lc3_decoder_frames_scratch_size()`
+ *                 bytes, aligned to pointer type
+ * return          Count of frames concealed by PLC  -1: Wrong parameters
+ *
+ * The frames follow each others in `in`, spaced by `nbytes`, and in `pcm`,
+ * spaced by the number of samples of a frame times `stride`. The output
+ * is the same as decoding the frames one by one with `lc3_decode()`,
+ * the processing is done stage by stage on blocks of frames, for offline
+ * jobs. The frames of a block are kept in the scratch buffer, the stack
+ * usage is the one of `lc3_decode()`.
+ */
+LC3_EXPORT int lc3_decode_frames(
+    lc3_decoder_t decoder, const void *in, int nbytes,
+    enum lc3_pcm_format fmt, void *pcm, int stride, int nframes,
+    void *scratch);
+
+/**
+ * Return the bands of a decoder
+ * decoder         Handle of the decoder
+ * lim             Return the limits of the bands, or NULL
+ * return          Number of bands, -1 on bad parameters
+ *
+ * The `nbands + 1` limits are indexes of spectral coefficients, whose
+ * count is the number of samples of a frame, at the stream samplerate.
+ */
+LC3_EXPORT int lc3_decoder_bands(lc3_decoder_t decoder, const int **lim);
+
+/**
+ * Decode the band energies of a sequence of frames
+ * decoder         Handle of the decoder
+ * in, nbytes      Input bitstreams, and size in bytes of each frame,
+ *                 NULL performs PLC
+ * lim, nbands     Limits (`nbands + 1` values) of the bands, in spectral
+ *                 coefficients, and number of bands. The limits NULL
+ *                 select the bands of the codec, see `lc3_decoder_bands()`.
+ * e               Output mean energies of the `nbands` bands, by frame
+ * nframes         Number of frames to decode
+ * return          Count of frames concealed by PLC  -1: Wrong parameters
+ *
+ * The decoding stops on the spectrum, skipping the inverse transform and
+ * the output of the samples. The frames follow each others in `in`,
+ * spaced by `nbytes`. The energies use the scale of 16 bits samples.
+ * The temporal state used by `lc3_decode()` (overlap of the inverse
+ * transform, LTPF history) is not advanced: decoding samples afterwards
+ * on the same decoder starts with a discontinuity. A decoder is thus
+ * dedicated to one kind of decoding.
+ */
+LC3_EXPORT int lc3_decode_energies(
+    lc3_decoder_t decoder, const void *in, int nbytes,
+    const int *lim, int nbands, float *e, int nframes);
+
 
 #ifdef __cplusplus
 }
@@ -83,6 +83,13 @@ enum lc3_srate {
 };
 
 
+/**
+ * Plan of a configuration, shared read-only by the instances
+ */
+
+struct lc3_plan;
+
+
 /**
  * Encoder state and memory
  */
@@ -105,6 +112,8 @@ typedef struct lc3_ltpf_analysis {
     int16_t x_12k8[384];
     int16_t x_6k4[178];
     int tc;
+
+    int64_t r_sums[98], e_sum;
 } lc3_ltpf_analysis_t;
 
 typedef struct lc3_spec_analysis {
@@ -112,13 +121,22 @@ typedef struct lc3_spec_analysis {
     int nbits_spare;
 } lc3_spec_analysis_t;
 
+#define LC3_VAD_NWIN  4
+
+typedef struct lc3_vad_analysis {
+    float min, win_min[LC3_VAD_NWIN];
+    int count, hangover;
+} lc3_vad_analysis_t;
+
 struct lc3_encoder {
     enum lc3_dt dt;
     enum lc3_srate sr, sr_pcm;
+    const struct lc3_plan *plan, *plan_pcm;
 
     lc3_attdet_analysis_t attdet;
     lc3_ltpf_analysis_t ltpf;
     lc3_spec_analysis_t spec;
+    lc3_vad_analysis_t vad;
 
     int xt_off, xs_off, xd_off;
     float x[1];
@@ -154,6 +172,7 @@ typedef struct lc3_plc_state {
 struct lc3_decoder {
     enum lc3_dt dt;
     enum lc3_srate sr, sr_pcm;
+    const struct lc3_plan *plan, *plan_pcm;
 
     lc3_ltpf_synthesis_t ltpf;
     lc3_plc_state_t plc;
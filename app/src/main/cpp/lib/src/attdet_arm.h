@@ -0,0 +1,86 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if (__ARM_FEATURE_SIMD32 && !(__GNUC__ < 10) || defined(TEST_ARM))
+
+#ifndef TEST_ARM
+#include <arm_acle.h>
+#endif /* TEST_ARM */
+
+
+/**
+ * Downsampled and filtered energy of blocks
+ * The downsampling sums pairs of samples with dual 16 bits MAC.
+ * The 16 bits truncation of the filtered value is done by taking
+ * the bottom halfword in the squaring instruction.
+ */
+#ifndef attdet_energy
+
+LC3_HOT static void arm_attdet_energy(
+    enum lc3_srate sr, const int16_t *x, int nblk, int32_t *e)
+{
+    const int16x2_t *xp = (const int16x2_t *)x;
+    const int16x2_t ones = 0x00010001;
+
+    for (int i = 0; i < nblk; i++) {
+        int32_t xn2, xn1, xn0, xn, xf;
+
+        e[i] = 0;
+
+        if (sr == LC3_SRATE_32K) {
+            xn2 = __smuad(xp[-2], ones) >> 1;
+            xn1 = __smuad(xp[-1], ones) >> 1;
+
+            for (int j = 0; j < 40; j += 2, xp += 2, xn2 = xn0, xn1 = xn) {
+                xn0 = __smuad(xp[0], ones) >> 1;
+                xn  = __smuad(xp[1], ones) >> 1;
+
+                xf = (3 * xn0 - 4 * xn1 + 1 * xn2) >> 3;
+                e[i] += __smulbb(xf, xf) >> 5;
+
+                xf = (3 * xn  - 4 * xn0 + 1 * xn1) >> 3;
+                e[i] += __smulbb(xf, xf) >> 5;
+            }
+        }
+
+        else {
+            xn2 = __smlad(xp[-2], 0x00000001, __smuad(xp[-3], ones)) >> 2;
+            xn1 = __smlad(xp[-2], 0x00010000, __smuad(xp[-1], ones)) >> 2;
+
+            for (int j = 0; j < 40; j += 2, xp += 3, xn2 = xn0, xn1 = xn) {
+                xn0 = __smlad(xp[1], 0x00000001, __smuad(xp[0], ones)) >> 2;
+                xn  = __smlad(xp[1], 0x00010000, __smuad(xp[2], ones)) >> 2;
+
+                xf = (3 * xn0 - 4 * xn1 + 1 * xn2) >> 3;
+                e[i] += __smulbb(xf, xf) >> 5;
+
+                xf = (3 * xn  - 4 * xn0 + 1 * xn1) >> 3;
+                e[i] += __smulbb(xf, xf) >> 5;
+            }
+        }
+    }
+}
+
+#ifndef TEST_ARM
+#define attdet_energy arm_attdet_energy
+#endif
+
+#endif /* attdet_energy */
+
+
+#endif /* __ARM_FEATURE_SIMD32 */
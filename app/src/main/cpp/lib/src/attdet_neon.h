@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+/**
+ * Downsampled and filtered energy of blocks, on 4 values at a time
+ * The downsampled signal is computed first, on 32 bits integers.
+ */
+#ifndef attdet_energy
+
+LC3_HOT static void neon_attdet_energy(
+    enum lc3_srate sr, const int16_t *x, int nblk, int32_t *e)
+{
+    int32_t xd[2 + 4*40];
+    int n = 40 * nblk;
+
+    if (sr == LC3_SRATE_32K) {
+        xd[0] = (x[-4] + x[-3]) >> 1;
+        xd[1] = (x[-2] + x[-1]) >> 1;
+
+        for (int i = 0; i < n; i += 4)
+            vst1q_s32(xd + 2 + i,
+                vshrq_n_s32(vpaddlq_s16(vld1q_s16(x + 2*i)), 1));
+    }
+
+    else {
+        xd[0] = (x[-6] + x[-5] + x[-4]) >> 2;
+        xd[1] = (x[-3] + x[-2] + x[-1]) >> 2;
+
+        for (int i = 0; i < n; i++, x += 3)
+            xd[2 + i] = (x[0] + x[1] + x[2]) >> 2;
+    }
+
+    for (int i = 0; i < nblk; i++) {
+        int32x4_t ei = vdupq_n_s32(0);
+
+        for (int j = 0; j < 40; j += 4) {
+            const int32_t *xn = xd + 2 + 40*i + j;
+
+            int32x4_t xf = vaddq_s32(vsubq_s32(
+                vmulq_n_s32(vld1q_s32(xn), 3),
+                vshlq_n_s32(vld1q_s32(xn - 1), 2) ), vld1q_s32(xn - 2));
+
+            xf = vshrq_n_s32(vshlq_n_s32(vshrq_n_s32(xf, 3), 16), 16);
+
+            ei = vaddq_s32(ei, vshrq_n_s32(vmulq_s32(xf, xf), 5));
+        }
+
+        e[i] = vaddvq_s32(ei);
+    }
+}
+
+#ifndef TEST_NEON
+#define attdet_energy neon_attdet_energy
+#endif
+
+#endif /* attdet_energy */
+
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
@@ -0,0 +1,86 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __SSE2__ && !defined(TEST_NEON)
+
+#include <immintrin.h>
+
+
+/**
+ * Downsampled and filtered energy of blocks, on 4 values at a time
+ * The downsampled signal is computed first, on 32 bits integers.
+ * The filtered value is truncated to 16 bits, by keeping it in the
+ * high part of the 32 bits lanes, that is then squared by `madd`.
+ */
+#ifndef attdet_energy
+
+LC3_HOT static void x86_attdet_energy(
+    enum lc3_srate sr, const int16_t *x, int nblk, int32_t *e)
+{
+    int32_t xd[2 + 4*40];
+    int n = 40 * nblk;
+
+    if (sr == LC3_SRATE_32K) {
+        xd[0] = (x[-4] + x[-3]) >> 1;
+        xd[1] = (x[-2] + x[-1]) >> 1;
+
+        for (int i = 0; i < n; i += 4)
+            _mm_storeu_si128((__m128i *)(xd + 2 + i), _mm_srai_epi32(
+                _mm_madd_epi16(_mm_loadu_si128((const __m128i *)(x + 2*i)),
+                               _mm_set1_epi16(1)), 1));
+    }
+
+    else {
+        xd[0] = (x[-6] + x[-5] + x[-4]) >> 2;
+        xd[1] = (x[-3] + x[-2] + x[-1]) >> 2;
+
+        for (int i = 0; i < n; i++, x += 3)
+            xd[2 + i] = (x[0] + x[1] + x[2]) >> 2;
+    }
+
+    for (int i = 0; i < nblk; i++) {
+        __m128i ei = _mm_setzero_si128();
+
+        for (int j = 0; j < 40; j += 4) {
+            const int32_t *xn = xd + 2 + 40*i + j;
+
+            __m128i x0 = _mm_loadu_si128((const __m128i *)(xn    ));
+            __m128i x1 = _mm_loadu_si128((const __m128i *)(xn - 1));
+            __m128i x2 = _mm_loadu_si128((const __m128i *)(xn - 2));
+
+            __m128i xf = _mm_add_epi32(_mm_sub_epi32(
+                _mm_add_epi32(x0, _mm_slli_epi32(x0, 1)),
+                _mm_slli_epi32(x1, 2) ), x2);
+
+            xf = _mm_slli_epi32(_mm_srai_epi32(xf, 3), 16);
+
+            ei = _mm_add_epi32(ei, _mm_srai_epi32(_mm_madd_epi16(xf, xf), 5));
+        }
+
+        ei = _mm_add_epi32(ei, _mm_shuffle_epi32(ei, 0x4e));
+        ei = _mm_add_epi32(ei, _mm_shuffle_epi32(ei, 0xb1));
+        e[i] = _mm_cvtsi128_si32(ei);
+    }
+}
+
+#define attdet_energy x86_attdet_energy
+
+#endif /* attdet_energy */
+
+
+#endif /* __SSE2__ */
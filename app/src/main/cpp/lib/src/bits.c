@@ -175,8 +175,14 @@ LC3_HOT static inline void ac_shift(
         if (ac->cache >= 0)
             ac_put(buffer, ac->cache + ac->carry);
 
-        for ( ; ac->carry_count > 0; ac->carry_count--)
-            ac_put(buffer, ac->carry ? 0x00 : 0xff);
+        if (ac->carry_count > 0) {
+            int n = LC3_MIN(ac->carry_count,
+                LC3_MAX(buffer->end - buffer->p_fw, 0));
+
+            memset(buffer->p_fw, ac->carry ? 0x00 : 0xff, n);
+            buffer->p_fw += n;
+            ac->carry_count = 0;
+        }
 
          ac->cache = ac->low >> 16;
          ac->carry = 0;
@@ -187,6 +193,19 @@ LC3_HOT static inline void ac_shift(
     ac->low = (ac->low << 8) & 0xffffff;
 }
 
+/**
+ * Arithmetic coder carry resolution
+ * ac              Arithmetic coder
+ *
+ * Symbols accumulate `low` on 25 bits. As the interval `low + range`
+ * shrinks between renormalizations, the carry bit can be set only once.
+ */
+static inline void ac_carry(struct lc3_bits_ac *ac)
+{
+    ac->carry |= ac->low >> 24;
+    ac->low &= 0xffffff;
+}
+
 /**
  * Arithmetic coder termination
  * ac              Arithmetic coder
@@ -196,6 +215,8 @@ LC3_HOT static inline void ac_shift(
 static void ac_terminate(struct lc3_bits_ac *ac,
     struct lc3_bits_buffer *buffer)
 {
+    ac_carry(ac);
+
     int nbits = 25 - ac_get_range_bits(ac);
     unsigned mask = 0xffffff >> nbits;
     unsigned val  = ac->low + mask;
@@ -289,6 +310,8 @@ LC3_HOT void lc3_ac_write_renorm(struct lc3_bits *bits)
 {
     struct lc3_bits_ac *ac = &bits->ac;
 
+    ac_carry(ac);
+
     for ( ; ac->range < 0x10000; ac->range <<= 8)
         ac_shift(ac, &bits->buffer);
 }
@@ -265,9 +265,6 @@ LC3_HOT static inline void lc3_put_symbol(
     ac->low += range * symbols[s].low;
     ac->range = range * symbols[s].range;
 
-    ac->carry |= ac->low >> 24;
-    ac->low &= 0xffffff;
-
     if (ac->range < 0x10000)
         lc3_ac_write_renorm(bits);
 }
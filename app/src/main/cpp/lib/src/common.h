@@ -43,6 +43,15 @@
 #define LC3_PLUS_HR 1
 #endif
 
+/**
+ * Generation of the twiddles and MDCT rotation tables at setup time,
+ * in place of the static ones, for a smaller binary
+ */
+
+#ifndef LC3_RUNTIME_TABLES
+#define LC3_RUNTIME_TABLES 0
+#endif
+
 #if LC3_PLUS
 #define LC3_IF_PLUS(a, b) (a)
 #else
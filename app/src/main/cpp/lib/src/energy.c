@@ -26,15 +26,19 @@
 bool lc3_energy_compute(
     enum lc3_dt dt, enum lc3_srate sr, const float *x, float *e)
 {
-    int nb = lc3_num_bands[dt][sr];
-    const int *lim = lc3_band_lim[dt][sr];
+    lc3_energy_bands(x, lc3_band_lim[dt][sr], lc3_num_bands[dt][sr], e);
 
-    /* Mean the square of coefficients within each band */
+    /* Return the near nyquist flag */
 
-    float e_sum[2] = { 0, 0 };
-    int iband_h = nb - (const int []){
-        [LC3_DT_2M5] = 2, [LC3_DT_5M ] = 3,
-        [LC3_DT_7M5] = 4, [LC3_DT_10M] = 2 }[dt];
+    return lc3_energy_nn_flag(dt, sr, e);
+}
+
+/**
+ * Energy estimation on a set of bands
+ */
+void lc3_energy_bands(const float *x, const int *lim, int nb, float *e)
+{
+    /* Mean the square of coefficients within each band */
 
     for (int iband = 0, i = lim[iband]; iband < nb; iband++) {
         int ie = lim[iband+1];
@@ -44,11 +48,25 @@ bool lc3_energy_compute(
         for (i++; i < ie; i++)
             sx2 += x[i] * x[i];
 
-        *e = sx2 / n;
-        e_sum[iband >= iband_h] += *(e++);
+        e[iband] = sx2 / n;
     }
+}
 
-    /* Return the near nyquist flag */
+/**
+ * Near Nyquist detection
+ */
+bool lc3_energy_nn_flag(
+    enum lc3_dt dt, enum lc3_srate sr, const float *e)
+{
+    int nb = lc3_num_bands[dt][sr];
+
+    float e_sum[2] = { 0, 0 };
+    int iband_h = nb - (const int []){
+        [LC3_DT_2M5] = 2, [LC3_DT_5M ] = 3,
+        [LC3_DT_7M5] = 4, [LC3_DT_10M] = 2 }[dt];
+
+    for (int iband = 0; iband < nb; iband++)
+        e_sum[iband >= iband_h] += e[iband];
 
     return e_sum[1] > 30 * e_sum[0];
 }
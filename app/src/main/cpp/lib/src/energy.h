@@ -32,5 +32,25 @@
 bool lc3_energy_compute(
     enum lc3_dt dt, enum lc3_srate sr, const float *x, float *e);
 
+/**
+ * Energy estimation on a set of bands
+ * x               Input MDCT coefficient
+ * lim, nb         Limits of the bands (`nb + 1` values), and number of bands
+ * e               Energy estimation per bands
+ */
+void lc3_energy_bands(const float *x, const int *lim, int nb, float *e);
+
+/**
+ * Near Nyquist detection
+ * dt, sr          Duration and samplerate of the frame
+ * e               Energy estimation per bands
+ * return          True when high energy detected near Nyquist frequency
+ *
+ * The energies can be given by `lc3_mdct_forward()`, fusing
+ * their estimation with the transformation.
+ */
+bool lc3_energy_nn_flag(
+    enum lc3_dt dt, enum lc3_srate sr, const float *e);
+
 
 #endif /* __LC3_ENERGY_H */
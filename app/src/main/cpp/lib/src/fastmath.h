@@ -69,6 +69,21 @@ static inline float lc3_frexpf(float _x, int *exp) {
     return x.f;
 }
 
+/**
+ * Tables of `lc3_exp2f()`
+ */
+
+/* --- 2^(i/8) for i from 0 to 7 --- */
+
+static const float lc3_exp2f_e[] = {
+    1.00000000e+00, 1.09050773e+00, 1.18920712e+00, 1.29683955e+00,
+    1.41421356e+00, 1.54221083e+00, 1.68179283e+00, 1.83400809e+00 };
+
+/* --- Polynomial approx in range 0 to 1/8 --- */
+
+static const float lc3_exp2f_p[] = {
+    1.00448128e-02, 5.54563260e-02, 2.40228756e-01, 6.93147140e-01 };
+
 /**
  * Fast 2^n approximation
  * x               Operand, range -100 to 100
@@ -76,16 +91,8 @@ static inline float lc3_frexpf(float _x, int *exp) {
  */
 static inline float lc3_exp2f(float x)
 {
-    /* --- 2^(i/8) for i from 0 to 7 --- */
-
-    static const float e[] = {
-        1.00000000e+00, 1.09050773e+00, 1.18920712e+00, 1.29683955e+00,
-        1.41421356e+00, 1.54221083e+00, 1.68179283e+00, 1.83400809e+00 };
-
-    /* --- Polynomial approx in range 0 to 1/8 --- */
-
-    static const float p[] = {
-        1.00448128e-02, 5.54563260e-02, 2.40228756e-01, 6.93147140e-01 };
+    const float *e = lc3_exp2f_e;
+    const float *p = lc3_exp2f_p;
 
     /* --- Split the operand ---
      *
@@ -119,6 +126,14 @@ static inline float lc3_exp2f(float x)
     return y.f;
 }
 
+/**
+ * Table of `lc3_log2f()`
+ * Polynomial approx in range 0.5 to 1
+ */
+
+static const float lc3_log2f_c[] = {
+    -1.29479677, 5.11769018, -8.42295281, 8.10557963, -3.50567360 };
+
 /**
  * Fast log2(x) approximation
  * x               Operand, greater than 0
@@ -126,14 +141,10 @@ static inline float lc3_exp2f(float x)
  */
 static inline float lc3_log2f(float x)
 {
+    const float *c = lc3_log2f_c;
     float y;
     int e;
 
-    /* --- Polynomial approx in range 0.5 to 1 --- */
-
-    static const float c[] = {
-        -1.29479677, 5.11769018, -8.42295281, 8.10557963, -3.50567360 };
-
     x = lc3_frexpf(x, &e);
 
     y = (    c[0]) * x;
@@ -157,6 +168,31 @@ static inline float lc3_log10f(float x)
     return log10f(2) * lc3_log2f(x);
 }
 
+/**
+ * Table of `lc3_db_q16()` in Q15
+ */
+
+static const uint16_t lc3_db_q16_table[][2] = {
+
+    /* [n][0] = 10 * log10(2) * log2(1 + n/32), with n = [0..15]     */
+    /* [n][1] = [n+1][0] - [n][0] (while defining [16][0])           */
+
+    {     0, 4379 }, {  4379, 4248 }, {  8627, 4125 }, { 12753, 4009 },
+    { 16762, 3899 }, { 20661, 3795 }, { 24456, 3697 }, { 28153, 3603 },
+    { 31755, 3514 }, { 35269, 3429 }, { 38699, 3349 }, { 42047, 3272 },
+    { 45319, 3198 }, { 48517, 3128 }, { 51645, 3061 }, { 54705, 2996 },
+
+    /* [n][0] = 10 * log10(2) * log2(1 + n/32) - 10 * log10(2) / 2,  */
+    /*     with n = [16..31]                                         */
+    /* [n][1] = [n+1][0] - [n][0] (while defining [32][0])           */
+
+    {  8381, 2934 }, { 11315, 2875 }, { 14190, 2818 }, { 17008, 2763 },
+    { 19772, 2711 }, { 22482, 2660 }, { 25142, 2611 }, { 27754, 2564 },
+    { 30318, 2519 }, { 32837, 2475 }, { 35312, 2433 }, { 37744, 2392 },
+    { 40136, 2352 }, { 42489, 2314 }, { 44803, 2277 }, { 47080, 2241 },
+
+};
+
 /**
  * Fast `10 * log10(x)` (or dB) approximation in fixed Q16
  * x               Operand, in range 2^-63 to 2^63 (1e-19 to 1e19)
@@ -167,29 +203,6 @@ static inline float lc3_log10f(float x)
  */
 static inline int32_t lc3_db_q16(float x)
 {
-    /* --- Table in Q15 --- */
-
-    static const uint16_t t[][2] = {
-
-        /* [n][0] = 10 * log10(2) * log2(1 + n/32), with n = [0..15]     */
-        /* [n][1] = [n+1][0] - [n][0] (while defining [16][0])           */
-
-        {     0, 4379 }, {  4379, 4248 }, {  8627, 4125 }, { 12753, 4009 },
-        { 16762, 3899 }, { 20661, 3795 }, { 24456, 3697 }, { 28153, 3603 },
-        { 31755, 3514 }, { 35269, 3429 }, { 38699, 3349 }, { 42047, 3272 },
-        { 45319, 3198 }, { 48517, 3128 }, { 51645, 3061 }, { 54705, 2996 },
-
-        /* [n][0] = 10 * log10(2) * log2(1 + n/32) - 10 * log10(2) / 2,  */
-        /*     with n = [16..31]                                         */
-        /* [n][1] = [n+1][0] - [n][0] (while defining [32][0])           */
-
-        {  8381, 2934 }, { 11315, 2875 }, { 14190, 2818 }, { 17008, 2763 },
-        { 19772, 2711 }, { 22482, 2660 }, { 25142, 2611 }, { 27754, 2564 },
-        { 30318, 2519 }, { 32837, 2475 }, { 35312, 2433 }, { 37744, 2392 },
-        { 40136, 2352 }, { 42489, 2314 }, { 44803, 2277 }, { 47080, 2241 },
-
-    };
-
     /* --- Approximation ---
      *
      *   10 * log10(x^2) = 10 * log10(2) * log2(x^2)
@@ -212,8 +225,60 @@ static inline int32_t lc3_db_q16(float x)
     int hi = (x2.u >> 18) & 0x1f;
     int lo = (x2.u >>  2) & 0xffff;
 
-    return e2 * 49321 + t[hi][0] + ((t[hi][1] * lo) >> 16);
+    const uint16_t *t = lc3_db_q16_table[hi];
+
+    return e2 * 49321 + t[0] + ((t[1] * lo) >> 16);
 }
 
 
+/**
+ * Array versions of the approximations
+ * x, y            Input and output arrays of `n` values, can be the same
+ *
+ * The results are bit-exact with the scalar functions, the SIMD versions
+ * follow the same operations, without fusing multiplications and additions.
+ */
+
+#include "fastmath_neon.h"
+#include "fastmath_x86.h"
+
+#ifndef lc3_log2f_array
+
+static inline void lc3_log2f_array(const float *x, float *y, int n)
+{
+    for (int i = 0; i < n; i++)
+        y[i] = lc3_log2f(x[i]);
+}
+
+#endif /* lc3_log2f_array */
+
+#ifndef lc3_exp2f_array
+
+static inline void lc3_exp2f_array(const float *x, float *y, int n)
+{
+    for (int i = 0; i < n; i++)
+        y[i] = lc3_exp2f(x[i]);
+}
+
+#endif /* lc3_exp2f_array */
+
+static inline void lc3_log10f_array(const float *x, float *y, int n)
+{
+    lc3_log2f_array(x, y, n);
+
+    for (int i = 0; i < n; i++)
+        y[i] *= log10f(2);
+}
+
+#ifndef lc3_db_q16_array
+
+static inline void lc3_db_q16_array(const float *x, int32_t *y, int n)
+{
+    for (int i = 0; i < n; i++)
+        y[i] = lc3_db_q16(x[i]);
+}
+
+#endif /* lc3_db_q16_array */
+
+
 #endif /* __LC3_FASTMATH_H */
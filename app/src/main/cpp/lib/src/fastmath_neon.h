@@ -0,0 +1,178 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+/**
+ * Fast log2(x) approximation, on 4 values
+ * The operations follow exactly the ones of `lc3_log2f()`,
+ * multiplications and additions are not fused.
+ */
+#ifndef lc3_log2f_array
+
+static inline void neon_log2f_array(const float *x, float *y, int n)
+{
+    const uint32x4_t exp_mask = vdupq_n_u32(LC3_IEEE754_EXP_MASK);
+    const uint32x4_t exp_bias = vdupq_n_u32(
+        (LC3_IEEE754_EXP_BIAS - 1) << LC3_IEEE754_EXP_SHL);
+
+    int i = 0;
+
+    for ( ; i + 4 <= n; i += 4) {
+        uint32x4_t u = vreinterpretq_u32_f32(vld1q_f32(x + i));
+
+        int32x4_t e = vsubq_s32(
+            vreinterpretq_s32_u32(vshrq_n_u32(
+                vandq_u32(u, exp_mask), LC3_IEEE754_EXP_SHL)),
+            vdupq_n_s32(LC3_IEEE754_EXP_BIAS - 1) );
+
+        float32x4_t m = vreinterpretq_f32_u32(
+            vorrq_u32(vbicq_u32(u, exp_mask), exp_bias));
+
+        float32x4_t yi;
+
+        yi = vmulq_f32(vdupq_n_f32(lc3_log2f_c[0]), m);
+        yi = vmulq_f32(vaddq_f32(yi, vdupq_n_f32(lc3_log2f_c[1])), m);
+        yi = vmulq_f32(vaddq_f32(yi, vdupq_n_f32(lc3_log2f_c[2])), m);
+        yi = vmulq_f32(vaddq_f32(yi, vdupq_n_f32(lc3_log2f_c[3])), m);
+        yi = vaddq_f32(yi, vdupq_n_f32(lc3_log2f_c[4]));
+
+        vst1q_f32(y + i, vaddq_f32(vcvtq_f32_s32(e), yi));
+    }
+
+    for ( ; i < n; i++)
+        y[i] = lc3_log2f(x[i]);
+}
+
+#ifndef TEST_NEON
+#define lc3_log2f_array neon_log2f_array
+#endif
+
+#endif /* lc3_log2f_array */
+
+
+/**
+ * Fast 2^n approximation, on 4 values
+ * The operations follow exactly the ones of `lc3_exp2f()`,
+ * multiplications and additions are not fused.
+ *
+ * The rounded integral part is taken back from the integer representation,
+ * that is not subject to the `fast-math` rewriting of `(x + c) - c`.
+ */
+#ifndef lc3_exp2f_array
+
+static inline void neon_exp2f_array(const float *x, float *y, int n)
+{
+    const float32x4_t c = vdupq_n_f32(0x1.8p20f);
+
+    int i = 0;
+
+    for ( ; i + 4 <= n; i += 4) {
+        float32x4_t xi = vld1q_f32(x + i);
+
+        int32x4_t k = vsubq_s32(
+            vreinterpretq_s32_f32(vaddq_f32(xi, c)),
+            vreinterpretq_s32_f32(c) );
+
+        xi = vsubq_f32(xi, vmulq_f32(vcvtq_f32_s32(k), vdupq_n_f32(0x1p-3f)));
+
+        float32x4_t e = vdupq_n_f32(0);
+        e = vld1q_lane_f32(lc3_exp2f_e + (vgetq_lane_s32(k, 0) & 7), e, 0);
+        e = vld1q_lane_f32(lc3_exp2f_e + (vgetq_lane_s32(k, 1) & 7), e, 1);
+        e = vld1q_lane_f32(lc3_exp2f_e + (vgetq_lane_s32(k, 2) & 7), e, 2);
+        e = vld1q_lane_f32(lc3_exp2f_e + (vgetq_lane_s32(k, 3) & 7), e, 3);
+
+        float32x4_t yi;
+
+        yi = vmulq_f32(vdupq_n_f32(lc3_exp2f_p[0]), xi);
+        yi = vmulq_f32(vaddq_f32(yi, vdupq_n_f32(lc3_exp2f_p[1])), xi);
+        yi = vmulq_f32(vaddq_f32(yi, vdupq_n_f32(lc3_exp2f_p[2])), xi);
+        yi = vmulq_f32(vaddq_f32(yi, vdupq_n_f32(lc3_exp2f_p[3])), xi);
+        yi = vmulq_f32(vaddq_f32(yi, vdupq_n_f32(1.f)), e);
+
+        vst1q_f32(y + i, vreinterpretq_f32_s32(vaddq_s32(
+            vreinterpretq_s32_f32(yi),
+            vshlq_n_s32(vshrq_n_s32(k, 3), LC3_IEEE754_EXP_SHL) )));
+    }
+
+    for ( ; i < n; i++)
+        y[i] = lc3_exp2f(x[i]);
+}
+
+#ifndef TEST_NEON
+#define lc3_exp2f_array neon_exp2f_array
+#endif
+
+#endif /* lc3_exp2f_array */
+
+
+/**
+ * Fast `10 * log10(x)` (or dB) approximation in fixed Q16, on 4 values
+ * The operations follow exactly the ones of `lc3_db_q16()`
+ */
+#ifndef lc3_db_q16_array
+
+static inline void neon_db_q16_array(const float *x, int32_t *y, int n)
+{
+    const uint16_t (*t)[2] = lc3_db_q16_table;
+
+    int i = 0;
+
+    for ( ; i + 4 <= n; i += 4) {
+        float32x4_t xi = vld1q_f32(x + i);
+        uint32x4_t u = vreinterpretq_u32_f32(vmulq_f32(xi, xi));
+
+        int32x4_t e2 = vsubq_s32(
+            vreinterpretq_s32_u32(vshrq_n_u32(u, 22)), vdupq_n_s32(2*127));
+        uint32x4_t hi = vandq_u32(vshrq_n_u32(u, 18), vdupq_n_u32(0x1f));
+        int32x4_t lo = vreinterpretq_s32_u32(
+            vandq_u32(vshrq_n_u32(u, 2), vdupq_n_u32(0xffff)) );
+
+        int32x4_t t0 = vdupq_n_s32(0), t1 = vdupq_n_s32(0);
+        t0 = vsetq_lane_s32(t[vgetq_lane_u32(hi, 0)][0], t0, 0);
+        t1 = vsetq_lane_s32(t[vgetq_lane_u32(hi, 0)][1], t1, 0);
+        t0 = vsetq_lane_s32(t[vgetq_lane_u32(hi, 1)][0], t0, 1);
+        t1 = vsetq_lane_s32(t[vgetq_lane_u32(hi, 1)][1], t1, 1);
+        t0 = vsetq_lane_s32(t[vgetq_lane_u32(hi, 2)][0], t0, 2);
+        t1 = vsetq_lane_s32(t[vgetq_lane_u32(hi, 2)][1], t1, 2);
+        t0 = vsetq_lane_s32(t[vgetq_lane_u32(hi, 3)][0], t0, 3);
+        t1 = vsetq_lane_s32(t[vgetq_lane_u32(hi, 3)][1], t1, 3);
+
+        vst1q_s32(y + i, vaddq_s32(
+            vaddq_s32(vmulq_n_s32(e2, 49321), t0),
+            vshrq_n_s32(vmulq_s32(t1, lo), 16) ));
+    }
+
+    for ( ; i < n; i++)
+        y[i] = lc3_db_q16(x[i]);
+}
+
+#ifndef TEST_NEON
+#define lc3_db_q16_array neon_db_q16_array
+#endif
+
+#endif /* lc3_db_q16_array */
+
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
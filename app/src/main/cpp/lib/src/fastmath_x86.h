@@ -0,0 +1,265 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __SSE4_1__ && !defined(TEST_NEON)
+
+#include <immintrin.h>
+
+
+/**
+ * Fast log2(x) approximation, on 4 or 8 values
+ * The operations follow exactly the ones of `lc3_log2f()`
+ */
+#ifndef lc3_log2f_array
+
+static inline __m128 x86_log2f_ps(__m128 x)
+{
+    const __m128i exp_mask = _mm_set1_epi32(LC3_IEEE754_EXP_MASK);
+
+    __m128i u = _mm_castps_si128(x);
+
+    __m128i e = _mm_sub_epi32(
+        _mm_srli_epi32(_mm_and_si128(u, exp_mask), LC3_IEEE754_EXP_SHL),
+        _mm_set1_epi32(LC3_IEEE754_EXP_BIAS - 1) );
+
+    x = _mm_castsi128_ps(_mm_or_si128( _mm_andnot_si128(exp_mask, u),
+        _mm_set1_epi32((LC3_IEEE754_EXP_BIAS - 1) << LC3_IEEE754_EXP_SHL) ));
+
+    __m128 y;
+
+    y = _mm_mul_ps(_mm_set1_ps(lc3_log2f_c[0]), x);
+    y = _mm_mul_ps(_mm_add_ps(y, _mm_set1_ps(lc3_log2f_c[1])), x);
+    y = _mm_mul_ps(_mm_add_ps(y, _mm_set1_ps(lc3_log2f_c[2])), x);
+    y = _mm_mul_ps(_mm_add_ps(y, _mm_set1_ps(lc3_log2f_c[3])), x);
+    y = _mm_add_ps(y, _mm_set1_ps(lc3_log2f_c[4]));
+
+    return _mm_add_ps(_mm_cvtepi32_ps(e), y);
+}
+
+#if __AVX2__
+
+static inline __m256 x86_log2f_ps256(__m256 x)
+{
+    const __m256i exp_mask = _mm256_set1_epi32(LC3_IEEE754_EXP_MASK);
+
+    __m256i u = _mm256_castps_si256(x);
+
+    __m256i e = _mm256_sub_epi32(
+        _mm256_srli_epi32(_mm256_and_si256(u, exp_mask), LC3_IEEE754_EXP_SHL),
+        _mm256_set1_epi32(LC3_IEEE754_EXP_BIAS - 1) );
+
+    x = _mm256_castsi256_ps(_mm256_or_si256( _mm256_andnot_si256(exp_mask, u),
+        _mm256_set1_epi32((LC3_IEEE754_EXP_BIAS - 1) << LC3_IEEE754_EXP_SHL) ));
+
+    __m256 y;
+
+    y = _mm256_mul_ps(_mm256_set1_ps(lc3_log2f_c[0]), x);
+    y = _mm256_mul_ps(_mm256_add_ps(y, _mm256_set1_ps(lc3_log2f_c[1])), x);
+    y = _mm256_mul_ps(_mm256_add_ps(y, _mm256_set1_ps(lc3_log2f_c[2])), x);
+    y = _mm256_mul_ps(_mm256_add_ps(y, _mm256_set1_ps(lc3_log2f_c[3])), x);
+    y = _mm256_add_ps(y, _mm256_set1_ps(lc3_log2f_c[4]));
+
+    return _mm256_add_ps(_mm256_cvtepi32_ps(e), y);
+}
+
+#endif /* __AVX2__ */
+
+static inline void x86_log2f_array(const float *x, float *y, int n)
+{
+    int i = 0;
+
+#if __AVX2__
+    for ( ; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(y + i, x86_log2f_ps256(_mm256_loadu_ps(x + i)));
+#endif
+
+    for ( ; i + 4 <= n; i += 4)
+        _mm_storeu_ps(y + i, x86_log2f_ps(_mm_loadu_ps(x + i)));
+
+    for ( ; i < n; i++)
+        y[i] = lc3_log2f(x[i]);
+}
+
+#define lc3_log2f_array x86_log2f_array
+
+#endif /* lc3_log2f_array */
+
+
+/**
+ * Fast 2^n approximation, on 4 or 8 values
+ * The operations follow exactly the ones of `lc3_exp2f()`
+ *
+ * The rounded integral part is taken back from the integer representation,
+ * that is not subject to the `fast-math` rewriting of `(x + c) - c`.
+ */
+#ifndef lc3_exp2f_array
+
+static inline __m128 x86_exp2f_ps(__m128 x)
+{
+    const __m128 c = _mm_set1_ps(0x1.8p20f);
+
+    __m128i k = _mm_sub_epi32(
+        _mm_castps_si128(_mm_add_ps(x, c)), _mm_castps_si128(c));
+
+    x = _mm_sub_ps(x, _mm_mul_ps(_mm_cvtepi32_ps(k), _mm_set1_ps(0x1p-3f)));
+
+    int32_t ki[4];
+    _mm_storeu_si128((__m128i *)ki, _mm_and_si128(k, _mm_set1_epi32(7)));
+
+    __m128 e = _mm_setr_ps(
+        lc3_exp2f_e[ki[0]], lc3_exp2f_e[ki[1]],
+        lc3_exp2f_e[ki[2]], lc3_exp2f_e[ki[3]] );
+
+    __m128 y;
+
+    y = _mm_mul_ps(_mm_set1_ps(lc3_exp2f_p[0]), x);
+    y = _mm_mul_ps(_mm_add_ps(y, _mm_set1_ps(lc3_exp2f_p[1])), x);
+    y = _mm_mul_ps(_mm_add_ps(y, _mm_set1_ps(lc3_exp2f_p[2])), x);
+    y = _mm_mul_ps(_mm_add_ps(y, _mm_set1_ps(lc3_exp2f_p[3])), x);
+    y = _mm_mul_ps(_mm_add_ps(y, _mm_set1_ps(1.f)), e);
+
+    return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(y),
+        _mm_slli_epi32(_mm_srai_epi32(k, 3), LC3_IEEE754_EXP_SHL) ));
+}
+
+#if __AVX2__
+
+static inline __m256 x86_exp2f_ps256(__m256 x)
+{
+    const __m256 c = _mm256_set1_ps(0x1.8p20f);
+
+    __m256i k = _mm256_sub_epi32(
+        _mm256_castps_si256(_mm256_add_ps(x, c)), _mm256_castps_si256(c));
+
+    x = _mm256_sub_ps(x,
+        _mm256_mul_ps(_mm256_cvtepi32_ps(k), _mm256_set1_ps(0x1p-3f)));
+
+    __m256 e = _mm256_permutevar8x32_ps(
+        _mm256_loadu_ps(lc3_exp2f_e), k);
+
+    __m256 y;
+
+    y = _mm256_mul_ps(_mm256_set1_ps(lc3_exp2f_p[0]), x);
+    y = _mm256_mul_ps(_mm256_add_ps(y, _mm256_set1_ps(lc3_exp2f_p[1])), x);
+    y = _mm256_mul_ps(_mm256_add_ps(y, _mm256_set1_ps(lc3_exp2f_p[2])), x);
+    y = _mm256_mul_ps(_mm256_add_ps(y, _mm256_set1_ps(lc3_exp2f_p[3])), x);
+    y = _mm256_mul_ps(_mm256_add_ps(y, _mm256_set1_ps(1.f)), e);
+
+    return _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(y),
+        _mm256_slli_epi32(_mm256_srai_epi32(k, 3), LC3_IEEE754_EXP_SHL) ));
+}
+
+#endif /* __AVX2__ */
+
+static inline void x86_exp2f_array(const float *x, float *y, int n)
+{
+    int i = 0;
+
+#if __AVX2__
+    for ( ; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(y + i, x86_exp2f_ps256(_mm256_loadu_ps(x + i)));
+#endif
+
+    for ( ; i + 4 <= n; i += 4)
+        _mm_storeu_ps(y + i, x86_exp2f_ps(_mm_loadu_ps(x + i)));
+
+    for ( ; i < n; i++)
+        y[i] = lc3_exp2f(x[i]);
+}
+
+#define lc3_exp2f_array x86_exp2f_array
+
+#endif /* lc3_exp2f_array */
+
+
+/**
+ * Fast `10 * log10(x)` (or dB) approximation in fixed Q16, on 4 or 8 values
+ * The operations follow exactly the ones of `lc3_db_q16()`
+ */
+#ifndef lc3_db_q16_array
+
+static inline __m128i x86_db_q16_ps(__m128 x)
+{
+    __m128i u = _mm_castps_si128(_mm_mul_ps(x, x));
+
+    __m128i e2 = _mm_sub_epi32(_mm_srli_epi32(u, 22), _mm_set1_epi32(2*127));
+    __m128i hi = _mm_and_si128(_mm_srli_epi32(u, 18), _mm_set1_epi32(0x1f));
+    __m128i lo = _mm_and_si128(_mm_srli_epi32(u,  2), _mm_set1_epi32(0xffff));
+
+    int32_t h[4];
+    _mm_storeu_si128((__m128i *)h, hi);
+
+    const uint16_t (*t)[2] = lc3_db_q16_table;
+    __m128i t0 = _mm_setr_epi32(t[h[0]][0], t[h[1]][0], t[h[2]][0], t[h[3]][0]);
+    __m128i t1 = _mm_setr_epi32(t[h[0]][1], t[h[1]][1], t[h[2]][1], t[h[3]][1]);
+
+    return _mm_add_epi32(
+        _mm_add_epi32(_mm_mullo_epi32(e2, _mm_set1_epi32(49321)), t0),
+        _mm_srai_epi32(_mm_mullo_epi32(t1, lo), 16) );
+}
+
+#if __AVX2__
+
+static inline __m256i x86_db_q16_ps256(__m256 x)
+{
+    __m256i u = _mm256_castps_si256(_mm256_mul_ps(x, x));
+
+    __m256i e2 = _mm256_sub_epi32(
+        _mm256_srli_epi32(u, 22), _mm256_set1_epi32(2*127));
+    __m256i hi = _mm256_and_si256(
+        _mm256_srli_epi32(u, 18), _mm256_set1_epi32(0x1f));
+    __m256i lo = _mm256_and_si256(
+        _mm256_srli_epi32(u,  2), _mm256_set1_epi32(0xffff));
+
+    __m256i th = _mm256_i32gather_epi32(
+        (const int *)lc3_db_q16_table, hi, sizeof(*lc3_db_q16_table));
+
+    __m256i t0 = _mm256_and_si256(th, _mm256_set1_epi32(0xffff));
+    __m256i t1 = _mm256_srli_epi32(th, 16);
+
+    return _mm256_add_epi32(
+        _mm256_add_epi32(_mm256_mullo_epi32(e2, _mm256_set1_epi32(49321)), t0),
+        _mm256_srai_epi32(_mm256_mullo_epi32(t1, lo), 16) );
+}
+
+#endif /* __AVX2__ */
+
+static inline void x86_db_q16_array(const float *x, int32_t *y, int n)
+{
+    int i = 0;
+
+#if __AVX2__
+    for ( ; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i *)(y + i),
+            x86_db_q16_ps256(_mm256_loadu_ps(x + i)));
+#endif
+
+    for ( ; i + 4 <= n; i += 4)
+        _mm_storeu_si128((__m128i *)(y + i),
+            x86_db_q16_ps(_mm_loadu_ps(x + i)));
+
+    for ( ; i < n; i++)
+        y[i] = lc3_db_q16(x[i]);
+}
+
+#define lc3_db_q16_array x86_db_q16_array
+
+#endif /* lc3_db_q16_array */
+
+
+#endif /* __SSE4_1__ */
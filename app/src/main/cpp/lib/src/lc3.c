@@ -30,6 +30,9 @@
 #include "tns.h"
 #include "spec.h"
 #include "plc.h"
+#include "vad.h"
+
+#include "lc3_neon.h"
 
 
 /**
@@ -43,6 +46,35 @@ struct side_data {
     lc3_sns_data_t sns;
     lc3_tns_data_t tns;
     lc3_spec_side_t spec;
+    float g;
+};
+
+/**
+ * Number of frames processed stage by stage, by the sequence functions
+ */
+
+#ifndef LC3_BATCH_FRAMES
+#define LC3_BATCH_FRAMES  4
+#endif
+
+/**
+ * Number of samples output at once, by the adaptive playout
+ */
+
+#ifndef LC3_PLAYOUT_BLOCK
+#define LC3_PLAYOUT_BLOCK  32
+#endif
+
+/**
+ * Scratch of a block of frames, by the sequence functions,
+ * followed by the `LC3_BATCH_FRAMES` spectra of the block
+ */
+
+struct frames_scratch {
+    struct side_data side[LC3_BATCH_FRAMES];
+    bool flag[LC3_BATCH_FRAMES];
+    float e[LC3_BATCH_FRAMES][LC3_MAX_BANDS];
+    float xf[];
 };
 
 
@@ -178,6 +210,18 @@ LC3_EXPORT int lc3_delay_samples(int dt_us, int sr_hz)
 }
 
 
+/**
+ * Return the size of the scratch of a block of frames
+ * plan_pcm        Plan of the PCM stream
+ * return          Size of the scratch in bytes
+ */
+static unsigned frames_scratch_size(const struct lc3_plan *plan_pcm)
+{
+    return sizeof(struct frames_scratch) +
+        LC3_BATCH_FRAMES * plan_pcm->ns * sizeof(float);
+}
+
+
 /* ----------------------------------------------------------------------------
  *  Encoder
  * -------------------------------------------------------------------------- */
@@ -186,39 +230,37 @@ LC3_EXPORT int lc3_delay_samples(int dt_us, int sr_hz)
  * Input PCM Samples from signed 16 bits
  * encoder         Encoder state
  * pcm, stride     Input PCM samples, and count between two consecutives
+ * xs              Output samples, in float
  */
+#ifndef load_s16
+
 static void load_s16(
-    struct lc3_encoder *encoder, const void *_pcm, int stride)
+    struct lc3_encoder *encoder, const void *_pcm, int stride, float *xs)
 {
     const int16_t *pcm = _pcm;
 
-    enum lc3_dt dt = encoder->dt;
-    enum lc3_srate sr = encoder->sr_pcm;
-
     int16_t *xt = (int16_t *)encoder->x + encoder->xt_off;
-    float *xs = encoder->x + encoder->xs_off;
-    int ns = lc3_ns(dt, sr);
+    int ns = encoder->plan_pcm->ns;
 
     for (int i = 0; i < ns; i++, pcm += stride)
         xt[i] = *pcm, xs[i] = *pcm;
 }
 
+#endif /* load_s16 */
+
 /**
  * Input PCM Samples from signed 24 bits
  * encoder         Encoder state
  * pcm, stride     Input PCM samples, and count between two consecutives
+ * xs              Output samples, in float
  */
 static void load_s24(
-    struct lc3_encoder *encoder, const void *_pcm, int stride)
+    struct lc3_encoder *encoder, const void *_pcm, int stride, float *xs)
 {
     const int32_t *pcm = _pcm;
 
-    enum lc3_dt dt = encoder->dt;
-    enum lc3_srate sr = encoder->sr_pcm;
-
     int16_t *xt = (int16_t *)encoder->x + encoder->xt_off;
-    float *xs = encoder->x + encoder->xs_off;
-    int ns = lc3_ns(dt, sr);
+    int ns = encoder->plan_pcm->ns;
 
     for (int i = 0; i < ns; i++, pcm += stride) {
         xt[i] = *pcm >> 8;
@@ -230,18 +272,15 @@ static void load_s24(
  * Input PCM Samples from signed 24 bits packed
  * encoder         Encoder state
  * pcm, stride     Input PCM samples, and count between two consecutives
+ * xs              Output samples, in float
  */
 static void load_s24_3le(
-    struct lc3_encoder *encoder, const void *_pcm, int stride)
+    struct lc3_encoder *encoder, const void *_pcm, int stride, float *xs)
 {
     const uint8_t *pcm = _pcm;
 
-    enum lc3_dt dt = encoder->dt;
-    enum lc3_srate sr = encoder->sr_pcm;
-
     int16_t *xt = (int16_t *)encoder->x + encoder->xt_off;
-    float *xs = encoder->x + encoder->xs_off;
-    int ns = lc3_ns(dt, sr);
+    int ns = encoder->plan_pcm->ns;
 
     for (int i = 0; i < ns; i++, pcm += 3*stride) {
         int32_t in = ((uint32_t)pcm[0] <<  8) |
@@ -257,18 +296,15 @@ static void load_s24_3le(
  * Input PCM Samples from float 32 bits
  * encoder         Encoder state
  * pcm, stride     Input PCM samples, and count between two consecutives
+ * xs              Output samples, in float
  */
 static void load_float(
-    struct lc3_encoder *encoder, const void *_pcm, int stride)
+    struct lc3_encoder *encoder, const void *_pcm, int stride, float *xs)
 {
     const float *pcm = _pcm;
 
-    enum lc3_dt dt = encoder->dt;
-    enum lc3_srate sr = encoder->sr_pcm;
-
     int16_t *xt = (int16_t *)encoder->x + encoder->xt_off;
-    float *xs = encoder->x + encoder->xs_off;
-    int ns = lc3_ns(dt, sr);
+    int ns = encoder->plan_pcm->ns;
 
     for (int i = 0; i < ns; i++, pcm += stride) {
         xs[i] = lc3_ldexpf(*pcm, 15);
@@ -277,27 +313,24 @@ static void load_float(
 }
 
 /**
- * Frame Analysis
+ * Temporal analysis of a frame
  * encoder         Encoder state
  * nbytes          Size in bytes of the frame
- * side            Return frame data
+ * side            Return the LTPF frame data
+ * return          True when an attack is detected
+ *
+ * The time-domain history of the encoder is consumed and updated,
+ * so the frames are analyzed in their order.
  */
-static void analyze(struct lc3_encoder *encoder,
+static bool analyze_temporal(struct lc3_encoder *encoder,
     int nbytes, struct side_data *side)
 {
     enum lc3_dt dt = encoder->dt;
-    enum lc3_srate sr = encoder->sr;
     enum lc3_srate sr_pcm = encoder->sr_pcm;
 
     int16_t *xt = (int16_t *)encoder->x + encoder->xt_off;
-    float *xs = encoder->x + encoder->xs_off;
-    int ns = lc3_ns(dt, sr_pcm);
-    int nt = lc3_nt(sr_pcm);
-
-    float *xd = encoder->x + encoder->xd_off;
-    float *xf = xs;
-
-    /* --- Temporal --- */
+    int ns = encoder->plan_pcm->ns;
+    int nt = encoder->plan_pcm->nt;
 
     bool att = lc3_attdet_run(dt, sr_pcm, nbytes, &encoder->attdet, xt);
 
@@ -306,13 +339,25 @@ static void analyze(struct lc3_encoder *encoder,
 
     memmove(xt - nt, xt + (ns-nt), nt * sizeof(*xt));
 
-    /* --- Spectral --- */
-
-    float e[LC3_MAX_BANDS];
+    return att;
+}
 
-    lc3_mdct_forward(dt, sr_pcm, sr, xs, xd, xf);
+/**
+ * Spectral shaping analysis of a frame
+ * encoder         Encoder state
+ * nbytes          Size in bytes of the frame
+ * att             Attack detection indication
+ * e               Energy estimation per band
+ * side            Return frame data
+ * xf              Spectral coefficients, shaped in place
+ */
+static void analyze_shaping(struct lc3_encoder *encoder,
+    int nbytes, bool att, const float *e, struct side_data *side, float *xf)
+{
+    enum lc3_dt dt = encoder->dt;
+    enum lc3_srate sr = encoder->sr;
 
-    bool nn_flag = lc3_energy_compute(dt, sr, xf, e);
+    bool nn_flag = lc3_energy_nn_flag(dt, sr, e);
     if (nn_flag)
         lc3_ltpf_disable(&side->ltpf);
 
@@ -321,6 +366,79 @@ static void analyze(struct lc3_encoder *encoder,
     lc3_sns_analyze(dt, sr, nbytes, e, att, &side->sns, xf, xf);
 
     lc3_tns_analyze(dt, side->bw, nn_flag, nbytes, &side->tns, xf);
+}
+
+/**
+ * Output the analysis of a frame
+ * encoder         Encoder state
+ * att             Attack detection indication
+ * e               Energy estimation per band
+ * side            Frame data
+ * analysis        Return the analysis of the frame
+ */
+static void analyze_output(struct lc3_encoder *encoder, bool att,
+    const float *e, const struct side_data *side,
+    struct lc3_frame_analysis *analysis)
+{
+    static const int bandwidth_hz[LC3_NUM_BANDWIDTH] = {
+        [LC3_BANDWIDTH_NB   ] =  4000, [LC3_BANDWIDTH_WB   ] =  8000,
+        [LC3_BANDWIDTH_SSWB ] = 12000, [LC3_BANDWIDTH_SWB  ] = 16000,
+        [LC3_BANDWIDTH_FB   ] = 24000, [LC3_BANDWIDTH_FB_HR] = 24000,
+        [LC3_BANDWIDTH_UB_HR] = 48000,
+    };
+
+    const struct lc3_ltpf_analysis *ltpf = &encoder->ltpf;
+    int nb = encoder->plan->nb;
+    float nc = side->pitch_present ? ltpf->nc[0] : 0;
+
+    analysis->nbands = nb;
+    memcpy(analysis->energies, e, nb * sizeof(*e));
+
+    analysis->attack = att;
+    analysis->bandwidth_hz = bandwidth_hz[side->bw];
+
+    analysis->pitch_present = side->pitch_present;
+    analysis->pitch_hz = side->pitch_present ? 4 * 12800.f / ltpf->pitch : 0;
+    analysis->correlation = nc;
+
+    analysis->vad = lc3_vad_run(encoder->dt, encoder->sr,
+        &encoder->vad, e, nc, &analysis->level_db);
+}
+
+/**
+ * Frame Analysis
+ * encoder         Encoder state
+ * nbytes          Size in bytes of the frame
+ * side            Return frame data
+ * analysis        Return the analysis of the frame, when not NULL
+ */
+static void analyze(struct lc3_encoder *encoder,
+    int nbytes, struct side_data *side, struct lc3_frame_analysis *analysis)
+{
+    enum lc3_dt dt = encoder->dt;
+    enum lc3_srate sr = encoder->sr;
+
+    float *xs = encoder->x + encoder->xs_off;
+    float *xd = encoder->x + encoder->xd_off;
+    float *xf = xs;
+
+    /* --- Temporal --- */
+
+    bool att = analyze_temporal(encoder, nbytes, side);
+
+    /* --- Spectral --- */
+
+    float e[LC3_MAX_BANDS];
+
+    lc3_mdct_forward(encoder->plan_pcm, encoder->plan, xs, xd, xf, e);
+
+    if (analysis && analysis->spectrum)
+        memcpy(analysis->spectrum, xf, encoder->plan->ns * sizeof(*xf));
+
+    analyze_shaping(encoder, nbytes, att, e, side, xf);
+
+    if (analysis)
+        analyze_output(encoder, att, e, side, analysis);
 
     lc3_spec_analyze(dt, sr,
         nbytes, side->pitch_present, &side->tns,
@@ -331,16 +449,16 @@ static void analyze(struct lc3_encoder *encoder,
  * Encode bitstream
  * encoder         Encoder state
  * side            The frame data
+ * xf              Quantized spectral coefficients
  * nbytes          Target size of the frame (20 to 400)
  * buffer          Output bitstream buffer of `nbytes` size
  */
 static void encode(struct lc3_encoder *encoder,
-    const struct side_data *side, int nbytes, void *buffer)
+    const struct side_data *side, float *xf, int nbytes, void *buffer)
 {
     enum lc3_dt dt = encoder->dt;
     enum lc3_srate sr = encoder->sr;
 
-    float *xf = encoder->x + encoder->xs_off;
     enum lc3_bandwidth bw = side->bw;
 
     lc3_bits_t bits;
@@ -407,11 +525,16 @@ LC3_EXPORT struct lc3_encoder *lc3_hr_setup_encoder(
         .dt = dt, .sr = sr,
         .sr_pcm = sr_pcm,
 
+        .plan = lc3_plan(dt, sr),
+        .plan_pcm = lc3_plan(dt, sr_pcm),
+
         .xt_off = nt,
         .xs_off = (nt + ns) / 2,
         .xd_off = (nt + ns) / 2 + ns,
     };
 
+    lc3_setup_tables(encoder->plan_pcm);
+
     memset(encoder->x, 0,
         LC3_ENCODER_BUFFER_COUNT(dt_us, sr_pcm_hz) * sizeof(float));
 
@@ -425,18 +548,47 @@ LC3_EXPORT struct lc3_encoder *lc3_setup_encoder(
 }
 
 /**
- * Encode a frame
+ * Return the number of PCM samples of a frame taken by the encoder
  */
-LC3_EXPORT int lc3_encode(struct lc3_encoder *encoder,
-    enum lc3_pcm_format fmt, const void *pcm, int stride, int nbytes, void *out)
+LC3_EXPORT int lc3_encoder_frame_samples(struct lc3_encoder *encoder)
 {
-    static void (* const load[])(struct lc3_encoder *, const void *, int) = {
-        [LC3_PCM_FORMAT_S16    ] = load_s16,
-        [LC3_PCM_FORMAT_S24    ] = load_s24,
-        [LC3_PCM_FORMAT_S24_3LE] = load_s24_3le,
-        [LC3_PCM_FORMAT_FLOAT  ] = load_float,
-    };
+    return encoder ? encoder->plan_pcm->ns : -1;
+}
+
+/**
+ * Return the size of the scratch buffer of the encoding of frames
+ */
+LC3_EXPORT unsigned lc3_encoder_frames_scratch_size(
+    struct lc3_encoder *encoder)
+{
+    return encoder ? frames_scratch_size(encoder->plan_pcm) : 0;
+}
+
+/**
+ * Input PCM loaders, and size in bytes of a sample, by format
+ */
+static void (* const load[])(
+    struct lc3_encoder *, const void *, int, float *) = {
+    [LC3_PCM_FORMAT_S16    ] = load_s16,
+    [LC3_PCM_FORMAT_S24    ] = load_s24,
+    [LC3_PCM_FORMAT_S24_3LE] = load_s24_3le,
+    [LC3_PCM_FORMAT_FLOAT  ] = load_float,
+};
+
+static const int pcm_sample_size[] = {
+    [LC3_PCM_FORMAT_S16    ] = sizeof(int16_t),
+    [LC3_PCM_FORMAT_S24    ] = sizeof(int32_t),
+    [LC3_PCM_FORMAT_S24_3LE] = 3,
+    [LC3_PCM_FORMAT_FLOAT  ] = sizeof(float),
+};
 
+/**
+ * Encode a frame, and return its analysis
+ */
+LC3_EXPORT int lc3_encode_analysis(struct lc3_encoder *encoder,
+    enum lc3_pcm_format fmt, const void *pcm, int stride, int nbytes, void *out,
+    struct lc3_frame_analysis *analysis)
+{
     /* --- Check parameters --- */
 
     if (!encoder || nbytes < lc3_min_frame_bytes(encoder->dt, encoder->sr)
@@ -447,15 +599,92 @@ LC3_EXPORT int lc3_encode(struct lc3_encoder *encoder,
 
     struct side_data side;
 
-    load[fmt](encoder, pcm, stride);
+    load[fmt](encoder, pcm, stride, encoder->x + encoder->xs_off);
 
-    analyze(encoder, nbytes, &side);
+    analyze(encoder, nbytes, &side, analysis);
 
-    encode(encoder, &side, nbytes, out);
+    encode(encoder, &side, encoder->x + encoder->xs_off, nbytes, out);
 
     return 0;
 }
 
+/**
+ * Encode a frame
+ */
+LC3_EXPORT int lc3_encode(struct lc3_encoder *encoder,
+    enum lc3_pcm_format fmt, const void *pcm, int stride, int nbytes, void *out)
+{
+    return lc3_encode_analysis(encoder, fmt, pcm, stride, nbytes, out, NULL);
+}
+
+/**
+ * Encode a sequence of frames
+ *
+ * The frames are processed by blocks of `LC3_BATCH_FRAMES`, stage by stage.
+ * The temporal analysis, the transform and the spectral quantization carry
+ * a state from one frame to the next, and are run in the order of the
+ * frames within their stage. The spectra of the block are kept aside.
+ */
+LC3_EXPORT int lc3_encode_frames(struct lc3_encoder *encoder,
+    enum lc3_pcm_format fmt, const void *pcm, int stride,
+    int nbytes, void *out, int nframes, void *scratch)
+{
+    /* --- Check parameters --- */
+
+    if (!encoder || nbytes < lc3_min_frame_bytes(encoder->dt, encoder->sr)
+                 || nbytes > lc3_max_frame_bytes(encoder->dt, encoder->sr)
+                 || nframes < 0 || !scratch)
+        return -1;
+
+    enum lc3_dt dt = encoder->dt;
+    enum lc3_srate sr = encoder->sr;
+
+    float *xd = encoder->x + encoder->xd_off;
+    size_t pcm_step = (size_t)encoder->plan_pcm->ns *
+                        stride * pcm_sample_size[fmt];
+
+    const uint8_t *pcm_p = pcm;
+    uint8_t *out_p = out;
+
+    /* --- Processing --- */
+
+    struct frames_scratch *block = scratch;
+    struct side_data *side = block->side;
+    bool *att = block->flag;
+    float (*e)[LC3_MAX_BANDS] = block->e;
+
+    int ns = encoder->plan_pcm->ns;
+    float *xf[LC3_BATCH_FRAMES];
+
+    for (int k = 0; k < LC3_BATCH_FRAMES; k++)
+        xf[k] = block->xf + k * ns;
+
+    for (int i = 0; i < nframes; i += LC3_BATCH_FRAMES) {
+        int n = LC3_MIN(nframes - i, LC3_BATCH_FRAMES);
+
+        for (int k = 0; k < n; k++, pcm_p += pcm_step) {
+            load[fmt](encoder, pcm_p, stride, xf[k]);
+            att[k] = analyze_temporal(encoder, nbytes, &side[k]);
+        }
+
+        for (int k = 0; k < n; k++)
+            lc3_mdct_forward(encoder->plan_pcm, encoder->plan,
+                xf[k], xd, xf[k], e[k]);
+
+        for (int k = 0; k < n; k++)
+            analyze_shaping(encoder, nbytes, att[k], e[k], &side[k], xf[k]);
+
+        for (int k = 0; k < n; k++)
+            lc3_spec_analyze(dt, sr,
+                nbytes, side[k].pitch_present, &side[k].tns,
+                &encoder->spec, xf[k], &side[k].spec);
+
+        for (int k = 0; k < n; k++, out_p += nbytes)
+            encode(encoder, &side[k], xf[k], nbytes, out_p);
+    }
+
+    return 0;
+}
 
 /* ----------------------------------------------------------------------------
  *  Decoder
@@ -463,42 +692,34 @@ LC3_EXPORT int lc3_encode(struct lc3_encoder *encoder,
 
 /**
  * Output PCM Samples to signed 16 bits
- * decoder         Decoder state
+ * xs, ns          Samples to output, and count
  * pcm, stride     Output PCM samples, and count between two consecutives
  */
+#ifndef store_s16
+
 static void store_s16(
-    struct lc3_decoder *decoder, void *_pcm, int stride)
+    const float *xs, int ns, void *_pcm, int stride)
 {
     int16_t *pcm = _pcm;
 
-    enum lc3_dt dt = decoder->dt;
-    enum lc3_srate sr = decoder->sr_pcm;
-
-    float *xs = decoder->x + decoder->xs_off;
-    int ns = lc3_ns(dt, sr);
-
     for ( ; ns > 0; ns--, xs++, pcm += stride) {
         int32_t s = *xs >= 0 ? (int)(*xs + 0.5f) : (int)(*xs - 0.5f);
         *pcm = LC3_SAT16(s);
     }
 }
 
+#endif /* store_s16 */
+
 /**
  * Output PCM Samples to signed 24 bits
- * decoder         Decoder state
+ * xs, ns          Samples to output, and count
  * pcm, stride     Output PCM samples, and count between two consecutives
  */
 static void store_s24(
-    struct lc3_decoder *decoder, void *_pcm, int stride)
+    const float *xs, int ns, void *_pcm, int stride)
 {
     int32_t *pcm = _pcm;
 
-    enum lc3_dt dt = decoder->dt;
-    enum lc3_srate sr = decoder->sr_pcm;
-
-    float *xs = decoder->x + decoder->xs_off;
-    int ns = lc3_ns(dt, sr);
-
     for ( ; ns > 0; ns--, xs++, pcm += stride) {
         int32_t s = *xs >= 0 ? (int32_t)(lc3_ldexpf(*xs, 8) + 0.5f)
                              : (int32_t)(lc3_ldexpf(*xs, 8) - 0.5f);
@@ -508,20 +729,14 @@ static void store_s24(
 
 /**
  * Output PCM Samples to signed 24 bits packed
- * decoder         Decoder state
+ * xs, ns          Samples to output, and count
  * pcm, stride     Output PCM samples, and count between two consecutives
  */
 static void store_s24_3le(
-    struct lc3_decoder *decoder, void *_pcm, int stride)
+    const float *xs, int ns, void *_pcm, int stride)
 {
     uint8_t *pcm = _pcm;
 
-    enum lc3_dt dt = decoder->dt;
-    enum lc3_srate sr = decoder->sr_pcm;
-
-    float *xs = decoder->x + decoder->xs_off;
-    int ns = lc3_ns(dt, sr);
-
     for ( ; ns > 0; ns--, xs++, pcm += 3*stride) {
         int32_t s = *xs >= 0 ? (int32_t)(lc3_ldexpf(*xs, 8) + 0.5f)
                              : (int32_t)(lc3_ldexpf(*xs, 8) - 0.5f);
@@ -535,20 +750,14 @@ static void store_s24_3le(
 
 /**
  * Output PCM Samples to float 32 bits
- * decoder         Decoder state
+ * xs, ns          Samples to output, and count
  * pcm, stride     Output PCM samples, and count between two consecutives
  */
 static void store_float(
-    struct lc3_decoder *decoder, void *_pcm, int stride)
+    const float *xs, int ns, void *_pcm, int stride)
 {
     float *pcm = _pcm;
 
-    enum lc3_dt dt = decoder->dt;
-    enum lc3_srate sr = decoder->sr_pcm;
-
-    float *xs = decoder->x + decoder->xs_off;
-    int ns = lc3_ns(dt, sr);
-
     for ( ; ns > 0; ns--, xs++, pcm += stride) {
         float s = lc3_ldexpf(*xs, -15);
         *pcm = fminf(fmaxf(s, -1.f), 1.f);
@@ -560,17 +769,17 @@ static void store_float(
  * decoder         Decoder state
  * data, nbytes    Input bitstream buffer
  * side            Return the side data
+ * xf              Return the spectral coefficients
  * return          0: Ok  < 0: Bitsream error detected
  */
 static int decode(struct lc3_decoder *decoder,
-    const void *data, int nbytes, struct side_data *side)
+    const void *data, int nbytes, struct side_data *side, float *xf)
 {
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr = decoder->sr;
 
-    float *xf = decoder->x + decoder->xs_off;
-    int ns = lc3_ns(dt, sr);
-    int ne = lc3_ne(dt, sr);
+    int ns = decoder->plan->ns;
+    int ne = decoder->plan->ne;
 
     lc3_bits_t bits;
     int ret = 0;
@@ -595,7 +804,7 @@ static int decode(struct lc3_decoder *decoder,
       lc3_ltpf_get_data(&bits, &side->ltpf);
 
     if ((ret = lc3_spec_decode(&bits, dt, sr,
-                    side->bw, nbytes, &side->spec, xf)) < 0)
+                    side->bw, nbytes, &side->spec, xf, &side->g)) < 0)
         return ret;
 
     memset(xf + ne, 0, (ns - ne) * sizeof(float));
@@ -604,62 +813,92 @@ static int decode(struct lc3_decoder *decoder,
 }
 
 /**
- * Frame synthesis
+ * Spectral synthesis of a frame
  * decoder         Decoder state
  * side            Frame data, NULL performs PLC
- * nbytes          Size in bytes of the frame
+ * x               Decoded coefficients, or last good spectrum on PLC
+ * y               Output spectrum, can be `x` on a good frame
+ *
+ * The PLC state is updated, so the frames are synthesized in their order.
  */
-static void synthesize(struct lc3_decoder *decoder,
-    const struct side_data *side, int nbytes)
+static void synthesize_spectrum(struct lc3_decoder *decoder,
+    const struct side_data *side, const float *x, float *y)
 {
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr = decoder->sr;
-    enum lc3_srate sr_pcm = decoder->sr_pcm;
 
-    float *xf = decoder->x + decoder->xs_off;
-    int ns = lc3_ns(dt, sr_pcm);
-    int ne = lc3_ne(dt, sr);
-
-    float *xg = decoder->x + decoder->xg_off;
-    float *xs = xf;
-
-    float *xd = decoder->x + decoder->xd_off;
-    float *xh = decoder->x + decoder->xh_off;
+    int ns = decoder->plan_pcm->ns;
+    int ne = decoder->plan->ne;
 
     if (side) {
-        enum lc3_bandwidth bw = side->bw;
-
         lc3_plc_suspend(&decoder->plc);
 
-        lc3_tns_synthesize(dt, bw, &side->tns, xf);
+        float g_sns[LC3_MAX_BANDS];
 
-        lc3_sns_synthesize(dt, sr, &side->sns, xf, xg);
+        lc3_sns_synthesize(dt, sr, &side->sns, g_sns);
 
-        lc3_mdct_inverse(dt, sr_pcm, sr, xg, xd, xs);
+        lc3_tns_synthesize(dt, sr, side->bw, &side->tns, side->g, g_sns, x, y);
 
-    } else {
-        lc3_plc_synthesize(dt, sr, &decoder->plc, xg, xf);
+    } else
+        lc3_plc_synthesize(dt, sr, &decoder->plc, x, y);
 
-        memset(xf + ne, 0, (ns - ne) * sizeof(float));
+    memset(y + ne, 0, (ns - ne) * sizeof(float));
+}
 
-        lc3_mdct_inverse(dt, sr_pcm, sr, xf, xd, xs);
-    }
+/**
+ * Temporal synthesis of a frame
+ * decoder         Decoder state
+ * side            Frame data, NULL performs PLC
+ * nbytes          Size in bytes of the frame
+ * x               Spectrum of the frame
+ */
+static void synthesize_temporal(struct lc3_decoder *decoder,
+    const struct side_data *side, int nbytes, const float *x)
+{
+    enum lc3_dt dt = decoder->dt;
+    enum lc3_srate sr = decoder->sr;
+    enum lc3_srate sr_pcm = decoder->sr_pcm;
+
+    float *xs = decoder->x + decoder->xs_off;
+    float *xd = decoder->x + decoder->xd_off;
+    float *xh = decoder->x + decoder->xh_off;
+
+    lc3_mdct_inverse(decoder->plan_pcm, decoder->plan, x, xd, xs);
 
     if (!lc3_hr(sr))
         lc3_ltpf_synthesize(dt, sr_pcm, nbytes, &decoder->ltpf,
             side && side->pitch_present ? &side->ltpf : NULL, xh, xs);
 }
 
+/**
+ * Frame synthesis
+ * decoder         Decoder state
+ * side            Frame data, NULL performs PLC
+ * nbytes          Size in bytes of the frame
+ */
+static void synthesize(struct lc3_decoder *decoder,
+    const struct side_data *side, int nbytes)
+{
+    float *xf = decoder->x + decoder->xs_off;
+    float *xg = decoder->x + decoder->xg_off;
+
+    if (side) {
+        synthesize_spectrum(decoder, side, xf, xg);
+        synthesize_temporal(decoder, side, nbytes, xg);
+    } else {
+        synthesize_spectrum(decoder, NULL, xg, xf);
+        synthesize_temporal(decoder, NULL, nbytes, xf);
+    }
+}
+
 /**
  * Update decoder state on decoding completion
  * decoder         Decoder state
  */
 static void complete(struct lc3_decoder *decoder)
 {
-    enum lc3_dt dt = decoder->dt;
-    enum lc3_srate sr_pcm = decoder->sr_pcm;
-    int nh = lc3_nh(dt, sr_pcm);
-    int ns = lc3_ns(dt, sr_pcm);
+    int nh = decoder->plan_pcm->nh;
+    int ns = decoder->plan_pcm->ns;
 
     decoder->xs_off = decoder->xs_off - decoder->xh_off < nh ?
         decoder->xs_off + ns : decoder->xh_off;
@@ -708,12 +947,17 @@ LC3_EXPORT struct lc3_decoder *lc3_hr_setup_decoder(
         .dt = dt, .sr = sr,
         .sr_pcm = sr_pcm,
 
+        .plan = lc3_plan(dt, sr),
+        .plan_pcm = lc3_plan(dt, sr_pcm),
+
         .xh_off = 0,
         .xs_off = nh,
         .xd_off = nh + ns,
         .xg_off = nh + ns + nd,
     };
 
+    lc3_setup_tables(decoder->plan_pcm);
+
     lc3_plc_reset(&decoder->plc);
 
     memset(decoder->x, 0,
@@ -728,19 +972,39 @@ LC3_EXPORT struct lc3_decoder *lc3_setup_decoder(
     return lc3_hr_setup_decoder(false, dt_us, sr_hz, sr_pcm_hz, mem);
 }
 
+/**
+ * Return the number of PCM samples of a frame output by the decoder
+ */
+LC3_EXPORT int lc3_decoder_frame_samples(struct lc3_decoder *decoder)
+{
+    return decoder ? decoder->plan_pcm->ns : -1;
+}
+
+/**
+ * Return the size of the scratch buffer of the decoding of frames
+ */
+LC3_EXPORT unsigned lc3_decoder_frames_scratch_size(
+    struct lc3_decoder *decoder)
+{
+    return decoder ? frames_scratch_size(decoder->plan_pcm) : 0;
+}
+
+/**
+ * Output PCM writers, by format
+ */
+static void (* const store[])(const float *, int, void *, int) = {
+    [LC3_PCM_FORMAT_S16    ] = store_s16,
+    [LC3_PCM_FORMAT_S24    ] = store_s24,
+    [LC3_PCM_FORMAT_S24_3LE] = store_s24_3le,
+    [LC3_PCM_FORMAT_FLOAT  ] = store_float,
+};
+
 /**
  * Decode a frame
  */
 LC3_EXPORT int lc3_decode(struct lc3_decoder *decoder,
     const void *in, int nbytes, enum lc3_pcm_format fmt, void *pcm, int stride)
 {
-    static void (* const store[])(struct lc3_decoder *, void *, int) = {
-        [LC3_PCM_FORMAT_S16    ] = store_s16,
-        [LC3_PCM_FORMAT_S24    ] = store_s24,
-        [LC3_PCM_FORMAT_S24_3LE] = store_s24_3le,
-        [LC3_PCM_FORMAT_FLOAT  ] = store_float,
-    };
-
     /* --- Check parameters --- */
 
     if (!decoder)
@@ -754,13 +1018,276 @@ LC3_EXPORT int lc3_decode(struct lc3_decoder *decoder,
 
     struct side_data side;
 
-    int ret = !in || (decode(decoder, in, nbytes, &side) < 0);
+    int ret = !in || (decode(decoder, in, nbytes,
+                        &side, decoder->x + decoder->xs_off) < 0);
 
     synthesize(decoder, ret ? NULL : &side, nbytes);
 
-    store[fmt](decoder, pcm, stride);
+    store[fmt](decoder->x + decoder->xs_off,
+        decoder->plan_pcm->ns, pcm, stride);
 
     complete(decoder);
 
     return ret;
 }
+
+/**
+ * Adjust the duration of a frame
+ * xh, nr          History ring buffer of the decoder, and its size
+ * xs, n           Samples of the frame, within the ring buffer
+ * t               Shift in samples, 0 < t < n to shorten, t <= n to lengthen
+ * lengthen        False to shorten the frame, true to lengthen it
+ * fmt             PCM output format
+ * pcm, stride     Output `n - t` or `n + t` PCM samples
+ *
+ * The frame is crossfaded to its copy shifted by `t` samples, ahead when
+ * shortening, or behind when lengthening. The output starts on the first
+ * sample of the frame, and ends on the last one. The samples are read in
+ * place, within the ring buffer, and output by blocks.
+ */
+static void adjust_playout(const float *xh, int nr, const float *xs,
+    int n, int t, bool lengthen, enum lc3_pcm_format fmt, void *pcm, int stride)
+{
+    int xo = xs - xh;
+    int ny = lengthen ? n + t : n - t;
+    int nc = lengthen ? n : n - t;
+    int dj = lengthen ? -t : t;
+    float dw = 1.f / nc;
+
+    size_t pcm_step = (size_t)stride * pcm_sample_size[fmt];
+    uint8_t *pcm_p = pcm;
+
+    float y[LC3_PLAYOUT_BLOCK];
+
+    for (int i0 = 0; i0 < ny; i0 += LC3_PLAYOUT_BLOCK) {
+        int nb = LC3_MIN(ny - i0, LC3_PLAYOUT_BLOCK);
+
+        for (int k = 0; k < nb; k++) {
+            int i = i0 + k, j = i + dj;
+            float xj = j >= 0 ? xs[j] : xh[xo + j < 0 ? xo + j + nr : xo + j];
+
+            y[k] = i < nc ? xs[i] + (i + 0.5f) * dw * (xj - xs[i]) : xj;
+        }
+
+        store[fmt](y, nb, pcm_p, stride);
+        pcm_p += nb * pcm_step;
+    }
+}
+
+/**
+ * Decode a frame, adjusting its duration for adaptive playout
+ */
+LC3_EXPORT int lc3_decode_adaptive(struct lc3_decoder *decoder,
+    const void *in, int nbytes, enum lc3_pcm_format fmt, void *pcm, int stride,
+    int adjust, int *nout)
+{
+    /* --- Check parameters --- */
+
+    if (!decoder || !nout)
+        return -1;
+
+    if (in && (nbytes < LC3_MIN_FRAME_BYTES ||
+               nbytes > lc3_max_frame_bytes(decoder->dt, decoder->sr) ))
+        return -1;
+
+    /* --- Processing --- */
+
+    struct side_data side;
+
+    int ret = !in || (decode(decoder, in, nbytes,
+                        &side, decoder->x + decoder->xs_off) < 0);
+
+    synthesize(decoder, ret ? NULL : &side, nbytes);
+
+    /* --- Shift of the adjustment, by whole pitch periods --- */
+
+    float *xs = decoder->x + decoder->xs_off;
+    int ns = decoder->plan_pcm->ns;
+    int t = 0;
+
+    if (adjust) {
+        bool voiced = !ret && side.pitch_present && !lc3_hr(decoder->sr);
+        int p = voiced ? (decoder->ltpf.pitch + 2) >> 2 : ns / 2;
+
+        /* Lengthening reads the past output, from the history kept for
+         * the LTPF, that is not present in high-resolution at 96 KHz */
+
+        int nh = decoder->plan_pcm->nh;
+
+        t = p <= ns / 2 ? (ns / 2 / p) * p : p;
+        if (t > (adjust > 0 ? LC3_MIN(ns, nh) : 3*ns/4))
+            t = 0;
+    }
+
+    /* --- Output --- */
+
+    if (t > 0) {
+        adjust_playout(decoder->x + decoder->xh_off,
+            decoder->plan_pcm->nh + ns, xs, ns, t, adjust > 0, fmt, pcm, stride);
+
+        *nout = adjust > 0 ? ns + t : ns - t;
+
+    } else {
+        *nout = ns;
+
+        store[fmt](xs, ns, pcm, stride);
+    }
+
+    complete(decoder);
+
+    return ret;
+}
+
+/**
+ * Decode a sequence of frames
+ *
+ * The frames are processed by blocks of `LC3_BATCH_FRAMES`, stage by stage,
+ * as for the encoding. The last good spectrum, source of the concealment,
+ * is tracked within the block, and saved back to the decoder state.
+ */
+LC3_EXPORT int lc3_decode_frames(struct lc3_decoder *decoder,
+    const void *in, int nbytes, enum lc3_pcm_format fmt, void *pcm, int stride,
+    int nframes, void *scratch)
+{
+    /* --- Check parameters --- */
+
+    if (!decoder || nframes < 0 || !scratch)
+        return -1;
+
+    if (in && (nbytes < LC3_MIN_FRAME_BYTES ||
+               nbytes > lc3_max_frame_bytes(decoder->dt, decoder->sr) ))
+        return -1;
+
+    float *xg = decoder->x + decoder->xg_off;
+    int ne = decoder->plan->ne;
+    size_t pcm_step = (size_t)decoder->plan_pcm->ns *
+                        stride * pcm_sample_size[fmt];
+
+    const uint8_t *in_p = in;
+    uint8_t *pcm_p = pcm;
+    int nplc = 0;
+
+    /* --- Processing --- */
+
+    struct frames_scratch *block = scratch;
+    struct side_data *side = block->side;
+    bool *plc = block->flag;
+
+    int ns = decoder->plan_pcm->ns;
+    float *xf[LC3_BATCH_FRAMES];
+
+    for (int k = 0; k < LC3_BATCH_FRAMES; k++)
+        xf[k] = block->xf + k * ns;
+
+    for (int i = 0; i < nframes; i += LC3_BATCH_FRAMES) {
+        int n = LC3_MIN(nframes - i, LC3_BATCH_FRAMES);
+        const float *x_good = xg;
+
+        for (int k = 0; k < n; k++) {
+            plc[k] = !in_p ||
+                (decode(decoder, in_p, nbytes, &side[k], xf[k]) < 0);
+            in_p = in_p ? in_p + nbytes : NULL;
+        }
+
+        for (int k = 0; k < n; k++) {
+            if (plc[k]) {
+                synthesize_spectrum(decoder, NULL, x_good, xf[k]);
+                nplc++;
+            } else {
+                synthesize_spectrum(decoder, &side[k], xf[k], xf[k]);
+                x_good = xf[k];
+            }
+        }
+
+        if (x_good != xg)
+            memcpy(xg, x_good, ne * sizeof(float));
+
+        for (int k = 0; k < n; k++, pcm_p += pcm_step) {
+            synthesize_temporal(decoder,
+                plc[k] ? NULL : &side[k], nbytes, xf[k]);
+
+            store[fmt](decoder->x + decoder->xs_off,
+                decoder->plan_pcm->ns, pcm_p, stride);
+
+            complete(decoder);
+        }
+    }
+
+    return nplc;
+}
+
+/**
+ * Return the bands of the decoder
+ */
+LC3_EXPORT int lc3_decoder_bands(
+    struct lc3_decoder *decoder, const int **lim)
+{
+    if (!decoder)
+        return -1;
+
+    if (lim)
+        *lim = decoder->plan->band_lim;
+
+    return decoder->plan->nb;
+}
+
+/**
+ * Decode the band energies of a sequence of frames
+ *
+ * The decoding stops on the synthesized spectrum, before the inverse
+ * transform. As for the complete decoding, the last good spectrum is
+ * kept in the decoder state as the source of the concealment.
+ * The temporal state (overlap of the inverse transform, LTPF history
+ * and position of the output samples) is not advanced.
+ */
+LC3_EXPORT int lc3_decode_energies(struct lc3_decoder *decoder,
+    const void *in, int nbytes, const int *lim, int nbands,
+    float *e, int nframes)
+{
+    /* --- Check parameters --- */
+
+    if (!decoder || nframes < 0)
+        return -1;
+
+    if (in && (nbytes < LC3_MIN_FRAME_BYTES ||
+               nbytes > lc3_max_frame_bytes(decoder->dt, decoder->sr) ))
+        return -1;
+
+    if (!lim && nbands != decoder->plan->nb)
+        return -1;
+
+    if (!lim)
+        lim = decoder->plan->band_lim;
+
+    if (nbands <= 0 || lim[0] < 0 || lim[nbands] > decoder->plan->ns)
+        return -1;
+
+    for (int i = 0; i < nbands; i++)
+        if (lim[i] >= lim[i+1])
+            return -1;
+
+    float *xg = decoder->x + decoder->xg_off;
+
+    const uint8_t *in_p = in;
+    int nplc = 0;
+
+    /* --- Processing --- */
+
+    struct side_data side;
+    float xf[LC3_MAX_NS];
+
+    for (int i = 0; i < nframes; i++, e += nbands) {
+        bool plc = !in_p || (decode(decoder, in_p, nbytes, &side, xf) < 0);
+        in_p = in_p ? in_p + nbytes : NULL;
+
+        if (plc) {
+            synthesize_spectrum(decoder, NULL, xg, xf);
+            nplc++;
+        } else
+            synthesize_spectrum(decoder, &side, xf, xg);
+
+        lc3_energy_bands(plc ? xf : xg, lim, nbands, e);
+    }
+
+    return nplc;
+}
@@ -0,0 +1,122 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+/**
+ * Input PCM Samples from signed 16 bits, on 8 values at a time
+ * Strided samples are gathered before the conversion.
+ */
+#ifndef load_s16
+
+LC3_HOT static void neon_load_s16(
+    struct lc3_encoder *encoder, const void *_pcm, int stride, float *xs)
+{
+    const int16_t *pcm = _pcm;
+
+    int16_t *xt = (int16_t *)encoder->x + encoder->xt_off;
+    int ns = encoder->plan_pcm->ns;
+
+    int i = 0;
+
+    for ( ; i + 8 <= ns; i += 8, pcm += 8*stride) {
+        int16x8_t xi;
+
+        if (stride == 1)
+            xi = vld1q_s16(pcm);
+
+        else {
+            int16_t t[8];
+            for (int k = 0; k < 8; k++)
+                t[k] = pcm[k*stride];
+            xi = vld1q_s16(t);
+        }
+
+        vst1q_s16(xt + i, xi);
+        vst1q_f32(xs + i + 0, vcvtq_f32_s32(vmovl_s16(vget_low_s16(xi))));
+        vst1q_f32(xs + i + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(xi))));
+    }
+
+    for ( ; i < ns; i++, pcm += stride)
+        xt[i] = *pcm, xs[i] = *pcm;
+}
+
+#ifndef TEST_NEON
+#define load_s16 neon_load_s16
+#endif
+
+#endif /* load_s16 */
+
+
+/**
+ * Output PCM Samples to signed 16 bits, on 8 values at a time
+ * The rounding half away from zero follows the generic version, and
+ * the saturation is done by the narrowing. Strided samples are scattered
+ * after the conversion.
+ */
+#ifndef store_s16
+
+LC3_HOT static inline int16x4_t neon_round_s16(float32x4_t x)
+{
+    float32x4_t h = vbslq_f32(vcgeq_f32(x, vdupq_n_f32(0)),
+        vdupq_n_f32(0.5f), vdupq_n_f32(-0.5f));
+
+    return vqmovn_s32(vcvtq_s32_f32(vaddq_f32(x, h)));
+}
+
+LC3_HOT static void neon_store_s16(
+    const float *xs, int ns, void *_pcm, int stride)
+{
+    int16_t *pcm = _pcm;
+
+    for ( ; ns >= 8; ns -= 8, xs += 8, pcm += 8*stride) {
+        int16x8_t s = vcombine_s16(
+            neon_round_s16(vld1q_f32(xs + 0)),
+            neon_round_s16(vld1q_f32(xs + 4)) );
+
+        if (stride == 1)
+            vst1q_s16(pcm, s);
+
+        else {
+            int16_t t[8];
+            vst1q_s16(t, s);
+            for (int k = 0; k < 8; k++)
+                pcm[k*stride] = t[k];
+        }
+    }
+
+    for ( ; ns > 0; ns--, xs++, pcm += stride) {
+        int32_t s = *xs >= 0 ? (int)(*xs + 0.5f) : (int)(*xs - 0.5f);
+        *pcm = LC3_SAT16(s);
+    }
+}
+
+#ifndef TEST_NEON
+#define store_s16 neon_store_s16
+#endif
+
+#endif /* store_s16 */
+
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
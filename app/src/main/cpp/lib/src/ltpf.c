@@ -20,6 +20,7 @@
 #include "tables.h"
 
 #include "ltpf_neon.h"
+#include "ltpf_x86.h"
 #include "ltpf_arm.h"
 
 
@@ -465,6 +466,30 @@ LC3_HOT static void correlate(
 }
 #endif /* correlate */
 
+/**
+ * Return vector of correlations, not scaled
+ * a, b, n         The 2 vector of size `n` (> 0 and <= 128)
+ * y, nc           Output the correlation vector of size `nc`
+ *
+ * The correlations are the exact sums `sum( a[i] * b[i] )`, that can be
+ * accumulated over successive parts of the vectors, before the scaling
+ * by 2^-6 of `dot()`. The size `n` of vectors is multiple of 16.
+ */
+#ifndef correlate_sums
+LC3_HOT static void correlate_sums(
+    const int16_t *a, const int16_t *b, int n, int64_t *y, int nc)
+{
+    for (const int64_t *ye = y + nc; y < ye; b--) {
+        int64_t v = 0;
+
+        for (int i = 0; i < n; i++)
+            v += a[i] * b[i];
+
+        *(y++) = v;
+    }
+}
+#endif /* correlate_sums */
+
 /**
  * Search the maximum value and returns its argument
  * x, n            The input vector of size `n`
@@ -574,22 +599,46 @@ LC3_HOT static float interpolate_corr(const float *x, int d)
  * Pitch detection algorithm
  * ltpf            Context of analysis
  * x, n            [-114..-17] Previous, [0..n-1] Current 6.4KHz samples
+ * overlap         The first half of the samples is the second half of the
+ *                 samples of the previous call
  * tc              Return the pitch-lag estimation
  * return          True when pitch present
  *
  * The `x` vector is aligned on 32 bits
+ *
+ * On overlapping windows, the sums of the correlations and the energy
+ * over the second half are kept, and reused as the sums over the first
+ * half on the next call. The results are the same, for half the work.
  */
 static bool detect_pitch(struct lc3_ltpf_analysis *ltpf,
-    const int16_t *x, int n, int *tc)
+    const int16_t *x, int n, bool overlap, int *tc)
 {
-    float rm1, rm2;
+    float rm1, rm2, e;
     float r[98];
 
     const int r0 = 17, nr = 98;
     int k0 = LC3_MAX(   0, ltpf->tc-4);
     int nk = LC3_MIN(nr-1, ltpf->tc+4) - k0 + 1;
 
-    correlate(x, x - r0, n, r, nr);
+    if (overlap) {
+        const int16_t *xh = x + (n >> 1);
+        int64_t rh[98], eh;
+
+        correlate_sums(xh, xh - r0, n >> 1, rh, nr);
+        correlate_sums(xh, xh, n >> 1, &eh, 1);
+
+        for (int i = 0; i < nr; i++) {
+            r[i] = (float)(int32_t)((ltpf->r_sums[i] + rh[i] + (1 << 5)) >> 6);
+            ltpf->r_sums[i] = rh[i];
+        }
+
+        e = (float)(int32_t)((ltpf->e_sum + eh + (1 << 5)) >> 6);
+        ltpf->e_sum = eh;
+
+    } else {
+        correlate(x, x - r0, n, r, nr);
+        e = dot(x, x, n);
+    }
 
     int t1 = argmax_weighted(r, nr, -.5f/(nr-1), &rm1);
     int t2 = k0 + argmax(r + k0, nk, &rm2);
@@ -598,10 +647,10 @@ static bool detect_pitch(struct lc3_ltpf_analysis *ltpf,
     const int16_t *x2 = x - (r0 + t2);
 
     float nc1 = rm1 <= 0 ? 0 :
-        rm1 / sqrtf(dot(x, x, n) * dot(x1, x1, n));
+        rm1 / sqrtf(e * dot(x1, x1, n));
 
     float nc2 = rm2 <= 0 ? 0 :
-        rm2 / sqrtf(dot(x, x, n) * dot(x2, x2, n));
+        rm2 / sqrtf(e * dot(x2, x2, n));
 
     int t1sel = nc2 <= 0.85f * nc1;
     ltpf->tc = (t1sel ? t1 : t2);
@@ -699,7 +748,8 @@ bool lc3_ltpf_analyse(
     int tc, pitch = 0;
     float nc = 0;
 
-    bool pitch_present = detect_pitch(ltpf, x_6k4, n_6k4, &tc);
+    bool pitch_present =
+        detect_pitch(ltpf, x_6k4, n_6k4, dt == LC3_DT_2M5, &tc);
 
     if (pitch_present) {
         int16_t u[128], v[128];
@@ -749,6 +799,43 @@ bool lc3_ltpf_analyse(
     (LC3_MAX_SRATE_HZ / 4000)
 
 
+/**
+ * Synthesis filter on a linear window of samples
+ * y               Filtered samples, delayed by the lag (w-1 + n values)
+ * xl              Input samples, preceded by w-1 previous ones
+ * x, n            Output filtered samples
+ * c, w            Coefficients `den` then `num`, and width of filter
+ * g, g_incr       Gain of the filter, and its increment per sample
+ * return          The gain following the last sample
+ *
+ * The outputs depend on filtered samples delayed by at least the lag,
+ * the window can be processed by blocks up to the lag minus the width.
+ * The taps of an output are accumulated in order, the SIMD versions keep
+ * this order, and are bit-exact with this one, as long as the compiler
+ * does not reassociate the sums (`-ffast-math`).
+ */
+#ifndef synthesize_block
+
+LC3_HOT static inline float synthesize_block(
+    const float *y, const float *xl, float *x, int n,
+    const float *c, const int w, float g, float g_incr)
+{
+    for (int i = 0; i < n; i++, g += g_incr) {
+        float u = 0;
+
+        for (int k = 0; k < w; k++) {
+            u -= y[i+k] * c[k];
+            u += xl[i+k] * c[w+k];
+        }
+
+        x[i] = xl[i+(w-1)] - g * u;
+    }
+
+    return g;
+}
+
+#endif /* synthesize_block */
+
 /**
  * Synthesis filter template
  * xh, nh          History ring buffer of filtered samples
@@ -757,6 +844,9 @@ bool lc3_ltpf_analyse(
  * x, n            Current samples as input, filtered as output
  * c, w            Coefficients `den` then `num`, and width of filter
  * fade            Fading mode of filter  -1: Out  1: In  0: None
+ *
+ * The filtered samples are read contiguously from the ring buffer,
+ * the few outputs straddling the wrap point are taken from a local copy.
  */
 LC3_HOT static inline void synthesize_template(
     const float *xh, int nh, int lag,
@@ -765,48 +855,40 @@ LC3_HOT static inline void synthesize_template(
 {
     float g = (float)(fade <= 0);
     float g_incr = (float)((fade > 0) - (fade < 0)) / n;
-    float u[MAX_FILTER_WIDTH];
-
-    /* --- Load previous samples --- */
-
-    lag += (w >> 1);
 
-    const float *y = x - xh < lag ? x + (nh - lag) : x - lag;
-    const float *y_end = xh + nh - 1;
+    /* --- Linearize input samples --- */
 
-    for (int j = 0; j < w-1; j++) {
+    float xl[MAX_FILTER_WIDTH-1 + LC3_MAX_FRAME_SAMPLES];
 
-        u[j] = 0;
+    memcpy(xl, x0, (w-1) * sizeof(float));
+    memcpy(xl + (w-1), x, n * sizeof(float));
 
-        float yi = *y, xi = *(x0++);
-        y = y < y_end ? y + 1 : xh;
+    /* --- Locate the wrap point of filtered samples --- */
 
-        for (int k = 0; k <= j; k++)
-            u[j-k] -= yi * c[k];
+    lag += (w >> 1);
 
-        for (int k = 0; k <= j; k++)
-            u[j-k] += xi * c[w+k];
-    }
+    int xo = x - xh;
+    const float *y = xo < lag ? x + (nh - lag) : x - lag;
+    int s = xo < lag ? lag - xo : n + w;
 
-    u[w-1] = 0;
+    int n0 = LC3_MIN(LC3_MAX(s - (w-1), 0), n);
+    int n1 = LC3_MIN(s, n);
 
-    /* --- Process by filter length --- */
+    /* --- Process before, across and after the wrap point --- */
 
-    for (int i = 0; i < n; i += w)
-        for (int j = 0; j < w; j++, g += g_incr) {
+    g = synthesize_block(y, xl, x, n0, c, w, g, g_incr);
 
-            float yi = *y, xi = *x;
-            y = y < y_end ? y + 1 : xh;
+    if (n1 > n0) {
+        float yw[2*MAX_FILTER_WIDTH];
 
-            for (int k = 0; k < w; k++)
-                u[(j+(w-1)-k)%w] -= yi * c[k];
+        for (int i = 0, p = xo - lag + n0; i < (n1-n0) + (w-1); i++, p++)
+            yw[i] = xh[p < 0 ? p + nh : p];
 
-            for (int k = 0; k < w; k++)
-                u[(j+(w-1)-k)%w] += xi * c[w+k];
+        g = synthesize_block(yw, xl + n0, x + n0, n1-n0, c, w, g, g_incr);
+    }
 
-            *(x++) = xi - g * u[j];
-            u[j] = 0;
-        }
+    if (n > n1)
+        synthesize_block(xh, xl + n1, x + n1, n-n1, c, w, g, g_incr);
 }
 
 /**
@@ -188,11 +188,12 @@ LC3_HOT static void neon_resample_48k_12k8(
 #endif /* resample_48k_12k8 */
 
 /**
- * Return dot product of 2 vectors
+ * Return dot product of 2 vectors, not scaled
  */
-#ifndef dot
+#if !defined(dot) || !defined(correlate) || !defined(correlate_sums)
 
-LC3_HOT static inline float neon_dot(const int16_t *a, const int16_t *b, int n)
+LC3_HOT static inline int64_t neon_dot_sum(
+    const int16_t *a, const int16_t *b, int n)
 {
     int64x2_t v = vmovq_n_s64(0);
 
@@ -208,7 +209,19 @@ LC3_HOT static inline float neon_dot(const int16_t *a, const int16_t *b, int n)
         v = vpadalq_s32(v, u);
     }
 
-    int32_t v32 = (vaddvq_s64(v) + (1 << 5)) >> 6;
+    return vaddvq_s64(v);
+}
+
+#endif
+
+/**
+ * Return dot product of 2 vectors
+ */
+#ifndef dot
+
+LC3_HOT static inline float neon_dot(const int16_t *a, const int16_t *b, int n)
+{
+    int32_t v32 = (neon_dot_sum(a, b, n) + (1 << 5)) >> 6;
     return (float)v32;
 }
 
@@ -218,6 +231,56 @@ LC3_HOT static inline float neon_dot(const int16_t *a, const int16_t *b, int n)
 
 #endif /* dot */
 
+/**
+ * Return 4 consecutive correlations, not scaled
+ * The vector `b` is moved backward of 1 sample, for each correlation
+ */
+#if !defined(correlate) || !defined(correlate_sums)
+
+LC3_HOT static inline void neon_correlate_4(
+    const int16_t *a, const int16_t *b, int n, int64_t *y)
+{
+    int64x2_t v0 = vmovq_n_s64(0), v1 = v0, v2 = v0, v3 = v0;
+    int16x4_t ax, b0, b1;
+
+    b0 = vld1_s16(b-4);
+
+    for (int i=0; i < (n >> 4); i++ )
+        for (int j = 0; j < 2; j++) {
+            int32x4_t u0, u1, u2, u3;
+
+            b1 = b0;
+            b0 = vld1_s16(b), b += 4;
+            ax = vld1_s16(a), a += 4;
+
+            u0 = vmull_s16(ax, b0);
+            u1 = vmull_s16(ax, vext_s16(b1, b0, 3));
+            u2 = vmull_s16(ax, vext_s16(b1, b0, 2));
+            u3 = vmull_s16(ax, vext_s16(b1, b0, 1));
+
+            b1 = b0;
+            b0 = vld1_s16(b), b += 4;
+            ax = vld1_s16(a), a += 4;
+
+            u0 = vmlal_s16(u0, ax, b0);
+            u1 = vmlal_s16(u1, ax, vext_s16(b1, b0, 3));
+            u2 = vmlal_s16(u2, ax, vext_s16(b1, b0, 2));
+            u3 = vmlal_s16(u3, ax, vext_s16(b1, b0, 1));
+
+            v0 = vpadalq_s32(v0, u0);
+            v1 = vpadalq_s32(v1, u1);
+            v2 = vpadalq_s32(v2, u2);
+            v3 = vpadalq_s32(v3, u3);
+        }
+
+    y[0] = vaddvq_s64(v0);
+    y[1] = vaddvq_s64(v1);
+    y[2] = vaddvq_s64(v2);
+    y[3] = vaddvq_s64(v3);
+}
+
+#endif
+
 /**
  * Return vector of correlations
  */
@@ -227,55 +290,96 @@ LC3_HOT static void neon_correlate(
     const int16_t *a, const int16_t *b, int n, float *y, int nc)
 {
     for ( ; nc >= 4; nc -= 4, b -= 4) {
-        const int16_t *an = (const int16_t *)a;
-        const int16_t *bn = (const int16_t *)b;
-
-        int64x2_t v0 = vmovq_n_s64(0), v1 = v0, v2 = v0, v3 = v0;
-        int16x4_t ax, b0, b1;
-
-        b0 = vld1_s16(bn-4);
-
-        for (int i=0; i < (n >> 4); i++ )
-            for (int j = 0; j < 2; j++) {
-                int32x4_t u0, u1, u2, u3;
-
-                b1 = b0;
-                b0 = vld1_s16(bn), bn += 4;
-                ax = vld1_s16(an), an += 4;
-
-                u0 = vmull_s16(ax, b0);
-                u1 = vmull_s16(ax, vext_s16(b1, b0, 3));
-                u2 = vmull_s16(ax, vext_s16(b1, b0, 2));
-                u3 = vmull_s16(ax, vext_s16(b1, b0, 1));
-
-                b1 = b0;
-                b0 = vld1_s16(bn), bn += 4;
-                ax = vld1_s16(an), an += 4;
-
-                u0 = vmlal_s16(u0, ax, b0);
-                u1 = vmlal_s16(u1, ax, vext_s16(b1, b0, 3));
-                u2 = vmlal_s16(u2, ax, vext_s16(b1, b0, 2));
-                u3 = vmlal_s16(u3, ax, vext_s16(b1, b0, 1));
-
-                v0 = vpadalq_s32(v0, u0);
-                v1 = vpadalq_s32(v1, u1);
-                v2 = vpadalq_s32(v2, u2);
-                v3 = vpadalq_s32(v3, u3);
-            }
-
-        *(y++) = (float)((int32_t)((vaddvq_s64(v0) + (1 << 5)) >> 6));
-        *(y++) = (float)((int32_t)((vaddvq_s64(v1) + (1 << 5)) >> 6));
-        *(y++) = (float)((int32_t)((vaddvq_s64(v2) + (1 << 5)) >> 6));
-        *(y++) = (float)((int32_t)((vaddvq_s64(v3) + (1 << 5)) >> 6));
+        int64_t v[4];
+
+        neon_correlate_4(a, b, n, v);
+
+        *(y++) = (float)((int32_t)((v[0] + (1 << 5)) >> 6));
+        *(y++) = (float)((int32_t)((v[1] + (1 << 5)) >> 6));
+        *(y++) = (float)((int32_t)((v[2] + (1 << 5)) >> 6));
+        *(y++) = (float)((int32_t)((v[3] + (1 << 5)) >> 6));
     }
 
     for ( ; nc > 0; nc--)
         *(y++) = neon_dot(a, b--, n);
 }
-#endif /* correlate */
 
 #ifndef TEST_NEON
 #define correlate neon_correlate
 #endif
 
+#endif /* correlate */
+
+/**
+ * Return vector of correlations, not scaled
+ */
+#ifndef correlate_sums
+
+LC3_HOT static void neon_correlate_sums(
+    const int16_t *a, const int16_t *b, int n, int64_t *y, int nc)
+{
+    for ( ; nc >= 4; nc -= 4, b -= 4, y += 4)
+        neon_correlate_4(a, b, n, y);
+
+    for ( ; nc > 0; nc--)
+        *(y++) = neon_dot_sum(a, b--, n);
+}
+
+#ifndef TEST_NEON
+#define correlate_sums neon_correlate_sums
+#endif
+
+#endif /* correlate_sums */
+
+/**
+ * Synthesis filter on a linear window of samples, 4 outputs at a time
+ * The operations follow exactly the ones of `synthesize_block()`,
+ * multiplications and additions are not fused. Built with `-ffast-math`,
+ * the compiler can reorder the sums of the two versions differently,
+ * and the outputs differ in the last bits.
+ */
+#ifndef synthesize_block
+
+LC3_HOT static inline float neon_synthesize_block(
+    const float *y, const float *xl, float *x, int n,
+    const float *c, const int w, float g, float g_incr)
+{
+    int i = 0;
+
+    for ( ; i + 4 <= n; i += 4) {
+        float32x4_t u = vdupq_n_f32(0);
+
+        for (int k = 0; k < w; k++) {
+            u = vsubq_f32(u, vmulq_n_f32(vld1q_f32(y + i+k), c[k]));
+            u = vaddq_f32(u, vmulq_n_f32(vld1q_f32(xl + i+k), c[w+k]));
+        }
+
+        float gi[4];
+        for (int j = 0; j < 4; j++, g += g_incr)
+            gi[j] = g;
+
+        vst1q_f32(x + i, vsubq_f32(
+            vld1q_f32(xl + i+(w-1)), vmulq_f32(vld1q_f32(gi), u)));
+    }
+
+    for ( ; i < n; i++, g += g_incr) {
+        float u = 0;
+
+        for (int k = 0; k < w; k++) {
+            u -= y[i+k] * c[k];
+            u += xl[i+k] * c[w+k];
+        }
+
+        x[i] = xl[i+(w-1)] - g * u;
+    }
+
+    return g;
+}
+
+#ifndef TEST_NEON
+#define synthesize_block neon_synthesize_block
+#endif
+
+#endif /* synthesize_block */
+
 #endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
@@ -0,0 +1,96 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __SSE__ && !defined(TEST_NEON)
+
+#include <immintrin.h>
+
+
+/**
+ * Synthesis filter on a linear window of samples, 4 or 8 outputs at a time
+ * The operations follow exactly the ones of `synthesize_block()`. Built with
+ * `-ffast-math`, the compiler can reorder the sums of the two versions
+ * differently, and the outputs differ in the last bits.
+ */
+#ifndef synthesize_block
+
+LC3_HOT static inline float x86_synthesize_block(
+    const float *y, const float *xl, float *x, int n,
+    const float *c, const int w, float g, float g_incr)
+{
+    int i = 0;
+
+#if __AVX__
+    for ( ; i + 8 <= n; i += 8) {
+        __m256 u = _mm256_setzero_ps();
+
+        for (int k = 0; k < w; k++) {
+            u = _mm256_sub_ps(u, _mm256_mul_ps(
+                _mm256_loadu_ps(y + i+k), _mm256_set1_ps(c[k])));
+            u = _mm256_add_ps(u, _mm256_mul_ps(
+                _mm256_loadu_ps(xl + i+k), _mm256_set1_ps(c[w+k])));
+        }
+
+        float gi[8];
+        for (int j = 0; j < 8; j++, g += g_incr)
+            gi[j] = g;
+
+        _mm256_storeu_ps(x + i, _mm256_sub_ps(
+            _mm256_loadu_ps(xl + i+(w-1)),
+            _mm256_mul_ps(_mm256_loadu_ps(gi), u) ));
+    }
+#endif
+
+    for ( ; i + 4 <= n; i += 4) {
+        __m128 u = _mm_setzero_ps();
+
+        for (int k = 0; k < w; k++) {
+            u = _mm_sub_ps(u, _mm_mul_ps(
+                _mm_loadu_ps(y + i+k), _mm_set1_ps(c[k])));
+            u = _mm_add_ps(u, _mm_mul_ps(
+                _mm_loadu_ps(xl + i+k), _mm_set1_ps(c[w+k])));
+        }
+
+        float gi[4];
+        for (int j = 0; j < 4; j++, g += g_incr)
+            gi[j] = g;
+
+        _mm_storeu_ps(x + i, _mm_sub_ps(
+            _mm_loadu_ps(xl + i+(w-1)), _mm_mul_ps(_mm_loadu_ps(gi), u)));
+    }
+
+    for ( ; i < n; i++, g += g_incr) {
+        float u = 0;
+
+        for (int k = 0; k < w; k++) {
+            u -= y[i+k] * c[k];
+            u += xl[i+k] * c[w+k];
+        }
+
+        x[i] = xl[i+(w-1)] - g * u;
+    }
+
+    return g;
+}
+
+#define synthesize_block x86_synthesize_block
+
+#endif /* synthesize_block */
+
+
+#endif /* __SSE__ */
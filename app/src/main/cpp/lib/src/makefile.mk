@@ -26,7 +26,8 @@ liblc3_src += \
     $(SRC_DIR)/sns.c \
     $(SRC_DIR)/spec.c \
     $(SRC_DIR)/tables.c \
-    $(SRC_DIR)/tns.c
+    $(SRC_DIR)/tns.c \
+    $(SRC_DIR)/vad.c
 
 liblc3_cflags += -ffast-math
 
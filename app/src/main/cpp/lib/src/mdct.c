@@ -157,6 +157,64 @@ LC3_HOT static inline void fft_bf2(
 }
 #endif /* fft_bf2 */
 
+/**
+ * FFT Butterfly 4 Points, as 2 successive radix-2 stages
+ * twiddles1/2     Twiddles factors of the 2 stages
+ * x, y            Input and output coefficients
+ * n               Number of interleaved transforms
+ *
+ * The operations follow exactly the ones of 2 calls to `fft_bf2()`,
+ * the results of the first stage are not stored back.
+ */
+#ifndef fft_bf4
+LC3_HOT static inline void fft_bf4(
+    const struct lc3_fft_bf2_twiddles *twiddles1,
+    const struct lc3_fft_bf2_twiddles *twiddles2,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n2 = twiddles1->n2;
+    const struct lc3_complex *w = twiddles1->t;
+    const struct lc3_complex *wa = twiddles2->t, *wb = wa + n2;
+
+    const struct lc3_complex *x0 = x, *x1 = x0 + n*n2;
+    const struct lc3_complex *x2 = x1 + n*n2, *x3 = x2 + n*n2;
+    struct lc3_complex *y0 = y, *y1 = y0 + n2, *y2 = y1 + n2, *y3 = y2 + n2;
+
+    for (int i = 0; i < n; i++,
+            y0 += 4*n2, y1 += 4*n2, y2 += 4*n2, y3 += 4*n2) {
+
+        for (int j = 0; j < n2; j++, x0++, x1++, x2++, x3++) {
+
+            struct lc3_complex u0, u1, v0, v1;
+
+            u0.re = x0->re + x2->re * w[j].re - x2->im * w[j].im;
+            u0.im = x0->im + x2->im * w[j].re + x2->re * w[j].im;
+
+            u1.re = x0->re - x2->re * w[j].re + x2->im * w[j].im;
+            u1.im = x0->im - x2->im * w[j].re - x2->re * w[j].im;
+
+            v0.re = x1->re + x3->re * w[j].re - x3->im * w[j].im;
+            v0.im = x1->im + x3->im * w[j].re + x3->re * w[j].im;
+
+            v1.re = x1->re - x3->re * w[j].re + x3->im * w[j].im;
+            v1.im = x1->im - x3->im * w[j].re - x3->re * w[j].im;
+
+            y0[j].re = u0.re + v0.re * wa[j].re - v0.im * wa[j].im;
+            y0[j].im = u0.im + v0.im * wa[j].re + v0.re * wa[j].im;
+
+            y2[j].re = u0.re - v0.re * wa[j].re + v0.im * wa[j].im;
+            y2[j].im = u0.im - v0.im * wa[j].re - v0.re * wa[j].im;
+
+            y1[j].re = u1.re + v1.re * wb[j].re - v1.im * wb[j].im;
+            y1[j].im = u1.im + v1.im * wb[j].re + v1.re * wb[j].im;
+
+            y3[j].re = u1.re - v1.re * wb[j].re + v1.im * wb[j].im;
+            y3[j].im = u1.im - v1.im * wb[j].re - v1.re * wb[j].im;
+        }
+    }
+}
+#endif /* fft_bf4 */
+
 /**
  * Perform FFT
  * x, y0, y1       Input, and 2 scratch buffers of size `n`
@@ -180,15 +238,24 @@ static struct lc3_complex *fft(const struct lc3_complex *x, int n,
      *       n = 90, 180                n3 = 2, n2 = [1..2]
      *
      * Note that the expression `n & (n-1) == 0` is equivalent
-     * to the check that `n` is a power of 2. */
+     * to the check that `n` is a power of 2.
+     *
+     * The radix-2 stages are processed by pairs, saving a pass
+     * over the buffers for each pair. */
 
     fft_5(x, y[is], n /= 5);
 
     for (i3 = 0; n & (n-1); i3++, is ^= 1)
         fft_bf3(lc3_fft_twiddles_bf3[i3], y[is], y[is ^ 1], n /= 3);
 
-    for (i2 = 0; n > 1; i2++, is ^= 1)
+    for (i2 = 0; n > 2; i2 += 2, is ^= 1)
+        fft_bf4(lc3_fft_twiddles_bf2[i2][i3], lc3_fft_twiddles_bf2[i2+1][i3],
+                y[is], y[is ^ 1], n >>= 2);
+
+    if (n > 1) {
         fft_bf2(lc3_fft_twiddles_bf2[i2][i3], y[is], y[is ^ 1], n >>= 1);
+        is ^= 1;
+    }
 
     return y[is];
 }
@@ -200,16 +267,15 @@ static struct lc3_complex *fft(const struct lc3_complex *x, int n,
 
 /**
  * Windowing of samples before MDCT
- * dt, sr          Duration and samplerate
+ * plan            Plan of the duration and samplerate
  * x, y            Input current and delayed samples
  * y, d            Output windowed samples, and delayed ones
  */
 LC3_HOT static void mdct_window(
-    enum lc3_dt dt, enum lc3_srate sr,
-    const float *x, float *d, float *y)
+    const struct lc3_plan *plan, const float *x, float *d, float *y)
 {
-    const float *win = lc3_mdct_win[dt][sr];
-    int ns = lc3_ns(dt, sr), nd = lc3_nd(dt, sr);
+    const float *win = plan->mdct_win;
+    int ns = plan->ns, nd = plan->nd;
 
     const float *w0 = win, *w1 = w0 + ns;
     const float *w2 = w1, *w3 = w2 + nd;
@@ -295,6 +361,81 @@ LC3_HOT static void mdct_post_fft(const struct lc3_mdct_rot_def *def,
     }
 }
 
+/**
+ * Post-rotate FFT N/4 points coefficients, resulting MDCT N points,
+ * with scaling and energy estimation per band
+ * def             Size and twiddles factors
+ * x, y            Input and output coefficients
+ * scale           Scale factor of the coefficients
+ * lim, nb         Limits of bands, and number of bands
+ * e               Return the energy estimation per band
+ *
+ * `x` and y` can be the same buffer
+ * The coefficients are output from the middle of the spectrum, the upper
+ * half upward and the lower half downward. The energies are accumulated
+ * on the fly in the same order, by a cursor on bands for each half.
+ */
+LC3_HOT static void mdct_post_fft_energy(const struct lc3_mdct_rot_def *def,
+    const struct lc3_complex *x, float *y, float scale,
+    const int *lim, int nb, float *e)
+{
+    int n4 = def->n4, n8 = n4 >> 1;
+
+    const struct lc3_complex *w0 = def->w + n8, *w1 = w0 - 1;
+    const struct lc3_complex *x0 = x + n8, *x1 = x0 - 1;
+
+    float *y0 = y + n4, *y1 = y0;
+
+    /* --- Locate the band of the middle coefficient ---
+     * When the bands end below the middle, the coefficients above
+     * are accumulated in a last band `nb`, that is discarded */
+
+    int bm = 0;
+    while (bm < nb && lim[bm+1] <= n4)
+        bm++;
+
+    int b0 = bm, ie0 = b0 < nb ? lim[b0+1] : INT_MAX;
+    int b1 = lim[bm] < n4 ? bm : bm-1, ie1 = lim[b1];
+
+    float s0 = 0, s1 = 0, sm = 0;
+
+    /* --- Rotate and accumulate energies --- */
+
+    for (int i = n4; y1 > y; x0++, x1--, w0++, w1--) {
+
+        float u0 = (x0->im * w0->im + x0->re * w0->re) * scale;
+        float u1 = (x1->re * w1->im - x1->im * w1->re) * scale;
+
+        float v0 = (x0->re * w0->im - x0->im * w0->re) * scale;
+        float v1 = (x1->im * w1->im + x1->re * w1->re) * scale;
+
+        *(y0++) = u0;  *(y0++) = u1;
+        *(--y1) = v0;  *(--y1) = v1;
+
+        for (int j = 0; j < 2; j++, i++) {
+            float u = j ? u1 : u0, v = j ? v1 : v0;
+
+            s0 += u * u;
+            if (i + 1 == ie0) {
+                e[b0] = b0 > bm ? s0 / (ie0 - lim[b0]) : s0;
+                s0 = 0, ie0 = ++b0 < nb ? lim[b0+1] : INT_MAX;
+            }
+
+            s1 += v * v;
+            if (2*n4-1 - i == ie1) {
+                if (b1 < bm)
+                    e[b1] = s1 / (lim[b1+1] - ie1);
+                else if (b1 < nb)
+                    sm = s1;
+                s1 = 0, ie1 = --b1 >= 0 ? lim[b1] : -1;
+            }
+        }
+    }
+
+    if (bm < nb)
+        e[bm] = (e[bm] + sm) / (lim[bm+1] - lim[bm]);
+}
+
 /**
  * Pre-rotate IMDCT coefficients of N points, before FFT N/4 points FFT
  * def             Size and twiddles factors
@@ -360,13 +501,12 @@ LC3_HOT static void imdct_post_fft(const struct lc3_mdct_rot_def *def,
 
 /**
  * Apply windowing of samples
- * dt, sr          Duration and samplerate
+ * plan            Plan of the duration and samplerate
  * x, d            Middle half of IMDCT coefficients and delayed samples
  * y, d            Output samples and delayed ones
  */
 LC3_HOT static void imdct_window(
-    enum lc3_dt dt, enum lc3_srate sr,
-    const float *x, float *d, float *y)
+    const struct lc3_plan *plan, const float *x, float *d, float *y)
 {
     /* The full MDCT coefficients is given by symmetry :
      *   T[   0 ..  n/4-1] = -half[n/4-1 .. 0    ]
@@ -374,8 +514,8 @@ LC3_HOT static void imdct_window(
      *   T[ n/2 .. 3n/4-1] =  half[n/4   .. n/2-1]
      *   T[3n/4 ..    n-1] =  half[n/2-1 .. n/4  ]  */
 
-    const float *win = lc3_mdct_win[dt][sr];
-    int n4 = lc3_ns(dt, sr) >> 1, nd = lc3_nd(dt, sr);
+    const float *win = plan->mdct_win;
+    int n4 = plan->ns >> 1, nd = plan->nd;
     const float *w2 = win, *w0 = w2 + 3*n4, *w1 = w0;
 
     const float *x0 = d + nd-n4, *x1 = x0;
@@ -428,21 +568,29 @@ LC3_HOT static void rescale(float *x, int n, float f)
  * Forward MDCT transformation
  */
 void lc3_mdct_forward(
-    enum lc3_dt dt, enum lc3_srate sr, enum lc3_srate sr_dst,
-    const float *x, float *d, float *y)
+    const struct lc3_plan *plan, const struct lc3_plan *plan_dst,
+    const float *x, float *d, float *y, float *e)
 {
-    const struct lc3_mdct_rot_def *rot = lc3_mdct_rot[dt][sr];
-    int ns_dst = lc3_ns(dt, sr_dst);
-    int ns = lc3_ns(dt, sr);
+    const struct lc3_mdct_rot_def *rot = plan->mdct_rot;
+    int ns_dst = plan_dst->ns;
+    int ns = plan->ns;
 
     struct lc3_complex buffer[LC3_MAX_NS / 2];
     struct lc3_complex *z = (struct lc3_complex *)y;
     union { float *f; struct lc3_complex *z; } u = { .z = buffer };
 
-    mdct_window(dt, sr, x, d, u.f);
+    mdct_window(plan, x, d, u.f);
 
     mdct_pre_fft(rot, u.f, u.z);
     u.z = fft(u.z, ns/2, u.z, z);
+
+    if (e) {
+        mdct_post_fft_energy(rot, u.z, y,
+            ns != ns_dst ? sqrtf((float)ns_dst / ns) : 1.f,
+            plan_dst->band_lim, plan_dst->nb, e);
+        return;
+    }
+
     mdct_post_fft(rot, u.z, y);
 
     if (ns != ns_dst)
@@ -453,12 +601,12 @@ void lc3_mdct_forward(
  * Inverse MDCT transformation
  */
 void lc3_mdct_inverse(
-    enum lc3_dt dt, enum lc3_srate sr, enum lc3_srate sr_src,
+    const struct lc3_plan *plan, const struct lc3_plan *plan_src,
     const float *x, float *d, float *y)
 {
-    const struct lc3_mdct_rot_def *rot = lc3_mdct_rot[dt][sr];
-    int ns_src = lc3_ns(dt, sr_src);
-    int ns = lc3_ns(dt, sr);
+    const struct lc3_mdct_rot_def *rot = plan->mdct_rot;
+    int ns_src = plan_src->ns;
+    int ns = plan->ns;
 
     struct lc3_complex buffer[LC3_MAX_NS / 2];
     struct lc3_complex *z = (struct lc3_complex *)y;
@@ -471,5 +619,5 @@ void lc3_mdct_inverse(
     if (ns != ns_src)
         rescale(u.f, ns, sqrtf((float)ns / ns_src));
 
-    imdct_window(dt, sr, u.f, d, y);
+    imdct_window(plan, u.f, d, y);
 }
@@ -20,32 +20,34 @@
 #define __LC3_MDCT_H
 
 #include "common.h"
+#include "tables.h"
 
 
 /**
  * Forward MDCT transformation
- * dt, sr          Duration and samplerate (size of the transform)
- * sr_dst          Samplerate destination, scale transforam accordingly
+ * plan            Plan of duration and samplerate (size of the transform)
+ * plan_dst        Plan of destination samplerate, scale transform accordingly
  * x, d            Temporal samples and delayed buffer
  * y, d            Output `ns` coefficients and `nd` delayed samples
+ * e               Return energy estimation per bands of `plan_dst`, or NULL
  *
  * `x` and `y` can be the same buffer
  */
 void lc3_mdct_forward(
-    enum lc3_dt dt, enum lc3_srate sr, enum lc3_srate sr_dst,
-    const float *x, float *d, float *y);
+    const struct lc3_plan *plan, const struct lc3_plan *plan_dst,
+    const float *x, float *d, float *y, float *e);
 
 /**
  * Inverse MDCT transformation
- * dt, sr          Duration and samplerate (size of the transform)
- * sr_src          Samplerate source, scale transforam accordingly
+ * plan            Plan of duration and samplerate (size of the transform)
+ * plan_src        Plan of source samplerate, scale transform accordingly
  * x, d            Frequency coefficients and delayed buffer
  * y, d            Output `ns` samples and `nd` delayed ones
  *
  * `x` and `y` can be the same buffer
  */
 void lc3_mdct_inverse(
-    enum lc3_dt dt, enum lc3_srate sr, enum lc3_srate sr_src,
+    const struct lc3_plan *plan, const struct lc3_plan *plan_src,
     const float *x, float *d, float *y);
 
 
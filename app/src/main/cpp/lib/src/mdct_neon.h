@@ -293,4 +293,113 @@ LC3_HOT static inline void neon_fft_bf2(
 
 #endif /* fft_bf2 */
 
+/**
+ * FFT Butterfly 4 Points, as 2 successive radix-2 stages
+ */
+#ifndef fft_bf4
+
+LC3_HOT static inline void neon_fft_bf2q(
+    float32x4_t x0, float32x4_t x1, float32x4_t w,
+    float32x4_t *y0, float32x4_t *y1)
+{
+    float32x4_t x1r = vtrn1q_f32( vrev64q_f32(vnegq_f32(x1)), x1 );
+    float32x4_t w_re = vtrn1q_f32(w, w);
+    float32x4_t w_im = vtrn2q_f32(w, w);
+
+    *y0 = vfmaq_f32( vfmaq_f32( x0, x1, w_re ), x1r, w_im );
+    *y1 = vfmsq_f32( vfmsq_f32( x0, x1, w_re ), x1r, w_im );
+}
+
+LC3_HOT static inline void neon_fft_bf2d(
+    float32x2_t x0, float32x2_t x1, float32x2_t w,
+    float32x2_t *y0, float32x2_t *y1)
+{
+    float32x2_t x1r = vtrn1_f32( vrev64_f32(vneg_f32(x1)), x1 );
+    float32x2_t w_re = vtrn1_f32(w, w);
+    float32x2_t w_im = vtrn2_f32(w, w);
+
+    *y0 = vfma_f32( vfma_f32( x0, x1, w_re ), x1r, w_im );
+    *y1 = vfms_f32( vfms_f32( x0, x1, w_re ), x1r, w_im );
+}
+
+LC3_HOT static inline void neon_fft_bf4(
+    const struct lc3_fft_bf2_twiddles *twiddles1,
+    const struct lc3_fft_bf2_twiddles *twiddles2,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n2 = twiddles1->n2;
+    const struct lc3_complex *w_ptr = twiddles1->t;
+    const struct lc3_complex *wa_ptr = twiddles2->t;
+    const struct lc3_complex *wb_ptr = wa_ptr + n2;
+
+    const struct lc3_complex *x0_ptr = x;
+    const struct lc3_complex *x1_ptr = x0_ptr + n*n2;
+    const struct lc3_complex *x2_ptr = x1_ptr + n*n2;
+    const struct lc3_complex *x3_ptr = x2_ptr + n*n2;
+
+    struct lc3_complex *y0_ptr = y;
+    struct lc3_complex *y1_ptr = y0_ptr + n2;
+    struct lc3_complex *y2_ptr = y1_ptr + n2;
+    struct lc3_complex *y3_ptr = y2_ptr + n2;
+
+    for (int j, i = 0; i < n; i++, y0_ptr += 4*n2,
+            y1_ptr += 4*n2, y2_ptr += 4*n2, y3_ptr += 4*n2) {
+
+        /* --- Process by pair --- */
+
+        for (j = 0; j < (n2 >> 1); j++,
+                x0_ptr += 2, x1_ptr += 2, x2_ptr += 2, x3_ptr += 2) {
+
+            float32x4_t w = vld1q_f32( (float *)(w_ptr + 2*j) );
+            float32x4_t u0, u1, v0, v1, y0, y1;
+
+            neon_fft_bf2q(vld1q_f32( (float *)x0_ptr ),
+                          vld1q_f32( (float *)x2_ptr ), w, &u0, &u1);
+
+            neon_fft_bf2q(vld1q_f32( (float *)x1_ptr ),
+                          vld1q_f32( (float *)x3_ptr ), w, &v0, &v1);
+
+            neon_fft_bf2q(u0, v0,
+                vld1q_f32( (float *)(wa_ptr + 2*j) ), &y0, &y1);
+            vst1q_f32( (float *)(y0_ptr + 2*j), y0 );
+            vst1q_f32( (float *)(y2_ptr + 2*j), y1 );
+
+            neon_fft_bf2q(u1, v1,
+                vld1q_f32( (float *)(wb_ptr + 2*j) ), &y0, &y1);
+            vst1q_f32( (float *)(y1_ptr + 2*j), y0 );
+            vst1q_f32( (float *)(y3_ptr + 2*j), y1 );
+        }
+
+        /* --- Last iteration --- */
+
+        if (n2 & 1) {
+
+            float32x2_t w = vld1_f32( (float *)(w_ptr + 2*j) );
+            float32x2_t u0, u1, v0, v1, y0, y1;
+
+            neon_fft_bf2d(vld1_f32( (float *)(x0_ptr++) ),
+                          vld1_f32( (float *)(x2_ptr++) ), w, &u0, &u1);
+
+            neon_fft_bf2d(vld1_f32( (float *)(x1_ptr++) ),
+                          vld1_f32( (float *)(x3_ptr++) ), w, &v0, &v1);
+
+            neon_fft_bf2d(u0, v0,
+                vld1_f32( (float *)(wa_ptr + 2*j) ), &y0, &y1);
+            vst1_f32( (float *)(y0_ptr + 2*j), y0 );
+            vst1_f32( (float *)(y2_ptr + 2*j), y1 );
+
+            neon_fft_bf2d(u1, v1,
+                vld1_f32( (float *)(wb_ptr + 2*j) ), &y0, &y1);
+            vst1_f32( (float *)(y1_ptr + 2*j), y0 );
+            vst1_f32( (float *)(y3_ptr + 2*j), y1 );
+        }
+    }
+}
+
+#ifndef TEST_NEON
+#define fft_bf4 neon_fft_bf4
+#endif
+
+#endif /* fft_bf4 */
+
 #endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
@@ -116,10 +116,15 @@ static const float dct16_m[16][16] = {
 
 };
 
+#include "sns_neon.h"
+#include "sns_x86.h"
+
 /**
  * Forward DCT-16 transformation
  * x, y            Input and output 16 values
  */
+#ifndef dct16_forward
+
 LC3_HOT static void dct16_forward(const float *x, float *y)
 {
     for (int i = 0, j; i < 16; i++)
@@ -127,10 +132,14 @@ LC3_HOT static void dct16_forward(const float *x, float *y)
             y[i] += x[j] * dct16_m[j][i];
 }
 
+#endif /* dct16_forward */
+
 /**
  * Inverse DCT-16 transformation
  * x, y            Input and output 16 values
  */
+#ifndef dct16_inverse
+
 LC3_HOT static void dct16_inverse(const float *x, float *y)
 {
     for (int i = 0, j; i < 16; i++)
@@ -138,11 +147,45 @@ LC3_HOT static void dct16_inverse(const float *x, float *y)
             y[i] += x[j] * dct16_m[i][j];
 }
 
+#endif /* dct16_inverse */
+
 
 /* ----------------------------------------------------------------------------
  *  Scale factors
  * -------------------------------------------------------------------------- */
 
+/**
+ * Smoothing and pre-emphasis of the band energies
+ * e               The 64 energies, smoothed and pre-emphasized in place
+ * ge              Pre-emphasis gains
+ * return          Sum of the output values
+ */
+#ifndef smooth_energies
+
+LC3_HOT static float smooth_energies(float *e, const float *ge)
+{
+    float e0 = e[0], e1 = e[0], e2;
+    float e_sum = 0;
+
+    for (int i = 0; i < LC3_MAX_BANDS-1; ) {
+        e[i] = (e0 * 0.25f + e1 * 0.5f + (e2 = e[i+1]) * 0.25f) * ge[i];
+        e_sum += e[i++];
+
+        e[i] = (e1 * 0.25f + e2 * 0.5f + (e0 = e[i+1]) * 0.25f) * ge[i];
+        e_sum += e[i++];
+
+        e[i] = (e2 * 0.25f + e0 * 0.5f + (e1 = e[i+1]) * 0.25f) * ge[i];
+        e_sum += e[i++];
+    }
+
+    e[LC3_MAX_BANDS-1] = (e0 * 0.25f + e1 * 0.75f) * ge[LC3_MAX_BANDS-1];
+    e_sum += e[LC3_MAX_BANDS-1];
+
+    return e_sum;
+}
+
+#endif /* smooth_energies */
+
 /**
  * Scale factors
  * dt, sr          Duration and samplerate of the frame
@@ -300,29 +343,17 @@ LC3_HOT static void compute_scale_factors(
 
     /* --- Smoothing, pre-emphasis and logarithm --- */
 
-    const float *ge = ge_table[sr];
-
-    float e0 = e[0], e1 = e[0], e2;
-    float e_sum = 0;
-
-    for (int i = 0; i < LC3_MAX_BANDS-1; ) {
-        e[i] = (e0 * 0.25f + e1 * 0.5f + (e2 = e[i+1]) * 0.25f) * ge[i];
-        e_sum += e[i++];
-
-        e[i] = (e1 * 0.25f + e2 * 0.5f + (e0 = e[i+1]) * 0.25f) * ge[i];
-        e_sum += e[i++];
+    float e_sum = smooth_energies(e, ge_table[sr]);
 
-        e[i] = (e2 * 0.25f + e0 * 0.5f + (e1 = e[i+1]) * 0.25f) * ge[i];
-        e_sum += e[i++];
-    }
+    float noise_floor = fmaxf(e_sum * (1e-4f / 64), 0x1p-32f);
 
-    e[LC3_MAX_BANDS-1] = (e0 * 0.25f + e1 * 0.75f) * ge[LC3_MAX_BANDS-1];
-    e_sum += e[LC3_MAX_BANDS-1];
+    for (int i = 0; i < LC3_MAX_BANDS; i++)
+        e[i] = LC3_MAX(e[i], noise_floor);
 
-    float noise_floor = fmaxf(e_sum * (1e-4f / 64), 0x1p-32f);
+    lc3_log2f_array(e, e, LC3_MAX_BANDS);
 
     for (int i = 0; i < LC3_MAX_BANDS; i++)
-        e[i] = lc3_log2f(fmaxf(e[i], noise_floor)) * 0.5f;
+        e[i] *= 0.5f;
 
     /* --- Grouping & scaling --- */
 
@@ -454,6 +485,29 @@ LC3_HOT static void add_pulse(const float *x, int *y, int n,
     }
 }
 
+/**
+ * Square errors of a shape, scaled by gain candidates
+ * x, cn           Transformed residual, and normalized shape
+ * g, ng           Gain candidates, and count (multiple of 2, up to 8)
+ * mse             Return the square error for each gain
+ */
+#ifndef shape_mse
+
+LC3_HOT static void shape_mse(
+    const float *x, const float *cn, const float *g, int ng, float *mse)
+{
+    for (int ig = 0; ig < ng; ig++) {
+        float gi = g[ig], e = 0;
+
+        for (int i = 0; i < 16; i++)
+            e += (x[i] - gi * cn[i]) * (x[i] - gi * cn[i]);
+
+        mse[ig] = e;
+    }
+}
+
+#endif /* shape_mse */
+
 /**
  * Quantization of codebooks residual
  * scf             Input 16 scale factors, output quantized version
@@ -555,18 +609,14 @@ LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
         float cmse_min = FLT_MAX;
         int cgain_idx = 0;
 
-        for (int ig = 0; ig < cgains->count; ig++) {
-            float g = cgains->v[ig];
-
-            float mse = 0;
-            for (int i = 0; i < 16; i++)
-                mse += (x[i] - g * cn[ic][i]) * (x[i] - g * cn[ic][i]);
+        float mse[8];
+        shape_mse(x, cn[ic], cgains->v, cgains->count, mse);
 
-            if (mse < cmse_min) {
+        for (int ig = 0; ig < cgains->count; ig++)
+            if (mse[ig] < cmse_min) {
                 cgain_idx = ig,
-                cmse_min = mse;
+                cmse_min = mse[ig];
             }
-        }
 
         if (cmse_min < mse_min) {
             *shape_idx = ic, *gain_idx = cgain_idx;
@@ -709,26 +759,24 @@ static void deenumerate(int shape,
  * -------------------------------------------------------------------------- */
 
 /**
- * Spectral shaping
+ * Gains of bands for spectral shaping
  * dt, sr          Duration and samplerate of the frame
  * scf_q           Quantized scale factors
  * inv             True on inverse shaping, False otherwise
- * x               Spectral coefficients
- * y               Return shapped coefficients
- *
- * `x` and `y` can be the same buffer
+ * g               Return the gains of the bands
  */
-LC3_HOT static void spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
-    const float *scf_q, bool inv, const float *x, float *y)
+LC3_HOT static void compute_band_gains(enum lc3_dt dt, enum lc3_srate sr,
+    const float *scf_q, bool inv, float *g)
 {
-    /* --- Interpolate scale factors --- */
+    /* --- Interpolate scale factors ---
+     * The scale factors are negated, as the gains of bands are `2^-scf` */
 
     float scf[LC3_MAX_BANDS];
-    float s0, s1 = inv ? -scf_q[0] : scf_q[0];
+    float s0, s1 = inv ? scf_q[0] : -scf_q[0];
 
     scf[0] = scf[1] = s1;
     for (int i = 0; i < 15; i++) {
-        s0 = s1, s1 = inv ? -scf_q[i+1] : scf_q[i+1];
+        s0 = s1, s1 = inv ? scf_q[i+1] : -scf_q[i+1];
         scf[4*i+2] = s0 + 0.125f * (s1 - s0);
         scf[4*i+3] = s0 + 0.375f * (s1 - s0);
         scf[4*i+4] = s0 + 0.625f * (s1 - s0);
@@ -750,16 +798,33 @@ LC3_HOT static void spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
 
     memmove(scf + n4 + n2, scf + 4*n4 + 2*n2, (nb - n4 - n2) * sizeof(float));
 
-    /* --- Spectral shaping --- */
+    /* --- Gains of bands --- */
+
+    lc3_exp2f_array(scf, g, nb);
+}
 
+/**
+ * Spectral shaping
+ * dt, sr          Duration and samplerate of the frame
+ * scf_q           Quantized scale factors
+ * x               Spectral coefficients
+ * y               Return shapped coefficients
+ *
+ * `x` and `y` can be the same buffer
+ */
+LC3_HOT static void spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
+    const float *scf_q, const float *x, float *y)
+{
     const int *lim = lc3_band_lim[dt][sr];
+    int nb = lc3_num_bands[dt][sr];
 
-    for (int i = 0, ib = 0; ib < nb; ib++) {
-        float g_sns = lc3_exp2f(-scf[ib]);
+    float g_sns[LC3_MAX_BANDS];
 
+    compute_band_gains(dt, sr, scf_q, false, g_sns);
+
+    for (int i = 0, ib = 0; ib < nb; ib++)
         for ( ; i < lim[ib+1]; i++)
-            y[i] = x[i] * g_sns;
-    }
+            y[i] = x[i] * g_sns[ib];
 }
 
 
@@ -798,7 +863,7 @@ void lc3_sns_analyze(
     enumerate(data->shape, c[data->shape],
         &data->idx_a, &data->ls_a, &data->idx_b, &data->ls_b);
 
-    spectral_shaping(dt, sr, scf, false, x, y);
+    spectral_shaping(dt, sr, scf, x, y);
 }
 
 /**
@@ -806,7 +871,7 @@ void lc3_sns_analyze(
  */
 void lc3_sns_synthesize(
     enum lc3_dt dt, enum lc3_srate sr,
-    const lc3_sns_data_t *data, const float *x, float *y)
+    const lc3_sns_data_t *data, float *g)
 {
     float scf[16], cn[16];
     int c[16];
@@ -818,7 +883,7 @@ void lc3_sns_synthesize(
 
     unquantize(data->lfcb, data->hfcb, cn, data->shape, data->gain, scf);
 
-    spectral_shaping(dt, sr, scf, true, x, y);
+    compute_band_gains(dt, sr, scf, true, g);
 }
 
 /**
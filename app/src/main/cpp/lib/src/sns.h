@@ -86,13 +86,12 @@ int lc3_sns_get_data(lc3_bits_t *bits, lc3_sns_data_t *data);
  * SNS synthesis
  * dt, sr          Duration and samplerate of the frame
  * data            Bitstream data
- * x               Spectral coefficients
- * y               Return shapped coefficients
+ * g               Return the shaping gains of the bands
  *
- * `x` and `y` can be the same buffer
+ * The gains are applied on the spectrum by `lc3_tns_synthesize()`
  */
 void lc3_sns_synthesize(enum lc3_dt dt, enum lc3_srate sr,
-    const lc3_sns_data_t *data, const float *x, float *y);
+    const lc3_sns_data_t *data, float *g);
 
 
 #endif /* __LC3_SNS_H */
@@ -0,0 +1,187 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+/**
+ * Forward DCT-16 transformation, on 4 values at a time
+ * The accumulation follows exactly the generic version,
+ * with the products fused as the compiler contracts them.
+ * The sums are reassociated differently with `-ffast-math`,
+ * and the results then differ in the last bits.
+ */
+#ifndef dct16_forward
+
+LC3_HOT static void neon_dct16_forward(const float *x, float *y)
+{
+    float32x4_t y0 = vdupq_n_f32(0), y1 = vdupq_n_f32(0);
+    float32x4_t y2 = vdupq_n_f32(0), y3 = vdupq_n_f32(0);
+
+    for (int j = 0; j < 16; j++) {
+        const float *m = dct16_m[j];
+
+        y0 = vfmaq_n_f32(y0, vld1q_f32(m +  0), x[j]);
+        y1 = vfmaq_n_f32(y1, vld1q_f32(m +  4), x[j]);
+        y2 = vfmaq_n_f32(y2, vld1q_f32(m +  8), x[j]);
+        y3 = vfmaq_n_f32(y3, vld1q_f32(m + 12), x[j]);
+    }
+
+    vst1q_f32(y +  0, y0);
+    vst1q_f32(y +  4, y1);
+    vst1q_f32(y +  8, y2);
+    vst1q_f32(y + 12, y3);
+}
+
+#ifndef TEST_NEON
+#define dct16_forward neon_dct16_forward
+#endif
+
+#endif /* dct16_forward */
+
+
+/**
+ * Inverse DCT-16 transformation, on 4 values at a time
+ * The matrix is transposed by blocks of 4x4, to keep the accumulation
+ * order of the generic version, unless reassociated by `-ffast-math`.
+ */
+#ifndef dct16_inverse
+
+LC3_HOT static void neon_dct16_inverse(const float *x, float *y)
+{
+    for (int i = 0; i < 16; i += 4) {
+        float32x4_t yi = vdupq_n_f32(0);
+
+        for (int j = 0; j < 16; j += 4) {
+            float32x4_t m0 = vld1q_f32(dct16_m[i+0] + j);
+            float32x4_t m1 = vld1q_f32(dct16_m[i+1] + j);
+            float32x4_t m2 = vld1q_f32(dct16_m[i+2] + j);
+            float32x4_t m3 = vld1q_f32(dct16_m[i+3] + j);
+
+            float64x2_t t0 = vreinterpretq_f64_f32(vtrn1q_f32(m0, m1));
+            float64x2_t t1 = vreinterpretq_f64_f32(vtrn2q_f32(m0, m1));
+            float64x2_t t2 = vreinterpretq_f64_f32(vtrn1q_f32(m2, m3));
+            float64x2_t t3 = vreinterpretq_f64_f32(vtrn2q_f32(m2, m3));
+
+            yi = vfmaq_n_f32(yi,
+                vreinterpretq_f32_f64(vtrn1q_f64(t0, t2)), x[j+0]);
+            yi = vfmaq_n_f32(yi,
+                vreinterpretq_f32_f64(vtrn1q_f64(t1, t3)), x[j+1]);
+            yi = vfmaq_n_f32(yi,
+                vreinterpretq_f32_f64(vtrn2q_f64(t0, t2)), x[j+2]);
+            yi = vfmaq_n_f32(yi,
+                vreinterpretq_f32_f64(vtrn2q_f64(t1, t3)), x[j+3]);
+        }
+
+        vst1q_f32(y + i, yi);
+    }
+}
+
+#ifndef TEST_NEON
+#define dct16_inverse neon_dct16_inverse
+#endif
+
+#endif /* dct16_inverse */
+
+
+/**
+ * Smoothing and pre-emphasis of the band energies, on 4 values at a time
+ * The products by powers of 2 are exact, the sum is kept sequential,
+ * unless reassociated by `-ffast-math`.
+ */
+#ifndef smooth_energies
+
+LC3_HOT static float neon_smooth_energies(float *e, const float *ge)
+{
+    float x[1 + LC3_MAX_BANDS];
+
+    x[0] = e[0];
+    memcpy(x + 1, e, LC3_MAX_BANDS * sizeof(float));
+
+    for (int i = 0; i < LC3_MAX_BANDS-4; i += 4) {
+        float32x4_t s = vaddq_f32(
+            vmulq_n_f32(vld1q_f32(x + i    ), 0.25f),
+            vmulq_n_f32(vld1q_f32(x + i + 1), 0.5f ) );
+
+        s = vaddq_f32(s, vmulq_n_f32(vld1q_f32(x + i + 2), 0.25f));
+
+        vst1q_f32(e + i, vmulq_f32(s, vld1q_f32(ge + i)));
+    }
+
+    for (int i = LC3_MAX_BANDS-4; i < LC3_MAX_BANDS-1; i++)
+        e[i] = (x[i] * 0.25f + x[i+1] * 0.5f + x[i+2] * 0.25f) * ge[i];
+
+    e[LC3_MAX_BANDS-1] = (x[LC3_MAX_BANDS-1] * 0.25f +
+                          x[LC3_MAX_BANDS  ] * 0.75f) * ge[LC3_MAX_BANDS-1];
+
+    float e_sum = 0;
+
+    for (int i = 0; i < LC3_MAX_BANDS; i++)
+        e_sum += e[i];
+
+    return e_sum;
+}
+
+#ifndef TEST_NEON
+#define smooth_energies neon_smooth_energies
+#endif
+
+#endif /* smooth_energies */
+
+
+/**
+ * Square errors of a shape, on 4 gain candidates at a time
+ * The products are fused as the compiler contracts the generic version.
+ */
+#ifndef shape_mse
+
+LC3_HOT static void neon_shape_mse(
+    const float *x, const float *cn, const float *g, int ng, float *mse)
+{
+    for (int ig = 0; ig < ng; ig += 4) {
+        bool half = ng - ig < 4;
+
+        float32x4_t gi = half ?
+            vcombine_f32(vld1_f32(g + ig), vdup_n_f32(0)) : vld1q_f32(g + ig);
+        float32x4_t e = vdupq_n_f32(0);
+
+        for (int i = 0; i < 16; i++) {
+            float32x4_t d = vfmsq_n_f32(vdupq_n_f32(x[i]), gi, cn[i]);
+            e = vfmaq_f32(e, d, d);
+        }
+
+        if (half)
+            vst1_f32(mse + ig, vget_low_f32(e));
+        else
+            vst1q_f32(mse + ig, e);
+    }
+}
+
+#ifndef TEST_NEON
+#define shape_mse neon_shape_mse
+#endif
+
+#endif /* shape_mse */
+
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
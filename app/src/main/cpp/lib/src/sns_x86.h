@@ -0,0 +1,137 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __SSE__ && !defined(TEST_NEON)
+
+#include <immintrin.h>
+
+
+/**
+ * Forward DCT-16 transformation, on 4 values at a time
+ * The accumulation follows exactly the generic version, multiplications
+ * and additions are not fused, and left to the contraction of the compiler
+ * as for the generic version. The sums are reassociated differently with
+ * `-ffast-math`, and the results then differ in the last bits.
+ */
+#ifndef dct16_forward
+
+LC3_HOT static void x86_dct16_forward(const float *x, float *y)
+{
+    __m128 y0 = _mm_setzero_ps(), y1 = _mm_setzero_ps();
+    __m128 y2 = _mm_setzero_ps(), y3 = _mm_setzero_ps();
+
+    for (int j = 0; j < 16; j++) {
+        const float *m = dct16_m[j];
+        __m128 xj = _mm_set1_ps(x[j]);
+
+        y0 = _mm_add_ps(_mm_mul_ps(xj, _mm_loadu_ps(m +  0)), y0);
+        y1 = _mm_add_ps(_mm_mul_ps(xj, _mm_loadu_ps(m +  4)), y1);
+        y2 = _mm_add_ps(_mm_mul_ps(xj, _mm_loadu_ps(m +  8)), y2);
+        y3 = _mm_add_ps(_mm_mul_ps(xj, _mm_loadu_ps(m + 12)), y3);
+    }
+
+    _mm_storeu_ps(y +  0, y0);
+    _mm_storeu_ps(y +  4, y1);
+    _mm_storeu_ps(y +  8, y2);
+    _mm_storeu_ps(y + 12, y3);
+}
+
+#define dct16_forward x86_dct16_forward
+
+#endif /* dct16_forward */
+
+
+/**
+ * Inverse DCT-16 transformation, on 4 values at a time
+ * The matrix is transposed by blocks of 4x4, to keep the accumulation
+ * order of the generic version, unless reassociated by `-ffast-math`.
+ */
+#ifndef dct16_inverse
+
+LC3_HOT static void x86_dct16_inverse(const float *x, float *y)
+{
+    for (int i = 0; i < 16; i += 4) {
+        __m128 yi = _mm_setzero_ps();
+
+        for (int j = 0; j < 16; j += 4) {
+            __m128 m0 = _mm_loadu_ps(dct16_m[i+0] + j);
+            __m128 m1 = _mm_loadu_ps(dct16_m[i+1] + j);
+            __m128 m2 = _mm_loadu_ps(dct16_m[i+2] + j);
+            __m128 m3 = _mm_loadu_ps(dct16_m[i+3] + j);
+
+            _MM_TRANSPOSE4_PS(m0, m1, m2, m3);
+
+            yi = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(x[j+0]), m0), yi);
+            yi = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(x[j+1]), m1), yi);
+            yi = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(x[j+2]), m2), yi);
+            yi = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(x[j+3]), m3), yi);
+        }
+
+        _mm_storeu_ps(y + i, yi);
+    }
+}
+
+#define dct16_inverse x86_dct16_inverse
+
+#endif /* dct16_inverse */
+
+
+/**
+ * Smoothing and pre-emphasis of the band energies, on 4 values at a time
+ * The products by powers of 2 are exact, the sum is kept sequential,
+ * unless reassociated by `-ffast-math`.
+ */
+#ifndef smooth_energies
+
+LC3_HOT static float x86_smooth_energies(float *e, const float *ge)
+{
+    float x[1 + LC3_MAX_BANDS];
+
+    x[0] = e[0];
+    memcpy(x + 1, e, LC3_MAX_BANDS * sizeof(float));
+
+    for (int i = 0; i < LC3_MAX_BANDS-4; i += 4) {
+        __m128 s = _mm_add_ps(
+            _mm_mul_ps(_mm_loadu_ps(x + i    ), _mm_set1_ps(0.25f)),
+            _mm_mul_ps(_mm_loadu_ps(x + i + 1), _mm_set1_ps(0.5f )) );
+
+        s = _mm_add_ps(s,
+            _mm_mul_ps(_mm_loadu_ps(x + i + 2), _mm_set1_ps(0.25f)) );
+
+        _mm_storeu_ps(e + i, _mm_mul_ps(s, _mm_loadu_ps(ge + i)));
+    }
+
+    for (int i = LC3_MAX_BANDS-4; i < LC3_MAX_BANDS-1; i++)
+        e[i] = (x[i] * 0.25f + x[i+1] * 0.5f + x[i+2] * 0.25f) * ge[i];
+
+    e[LC3_MAX_BANDS-1] = (x[LC3_MAX_BANDS-1] * 0.25f +
+                          x[LC3_MAX_BANDS  ] * 0.75f) * ge[LC3_MAX_BANDS-1];
+
+    float e_sum = 0;
+
+    for (int i = 0; i < LC3_MAX_BANDS; i++)
+        e_sum += e[i];
+
+    return e_sum;
+}
+
+#define smooth_energies x86_smooth_energies
+
+#endif /* smooth_energies */
+
+#endif /* __SSE__ */
@@ -20,6 +20,9 @@
 #include "bits.h"
 #include "tables.h"
 
+#include "spec_neon.h"
+#include "spec_x86.h"
+
 
 /* ----------------------------------------------------------------------------
  *  Global Gain / Quantization
@@ -67,6 +70,37 @@ static float unquantize_gain(int g_int)
     return g * iq_table[g_int];
 }
 
+/**
+ * Energy of blocks of 4 coefficients
+ * x, n4           Spectral coefficients, and count of blocks
+ * e               Return the energies of the blocks
+ * return          The maximum of the squared coefficients
+ */
+#ifndef block_energies
+
+LC3_HOT static float block_energies(const float *x, int n4, float *e)
+{
+    float x2_max = 0;
+
+    for (int i = 0; i < n4; i++) {
+        float x0 = x[4*i + 0] * x[4*i + 0];
+        float x1 = x[4*i + 1] * x[4*i + 1];
+        float x2 = x[4*i + 2] * x[4*i + 2];
+        float x3 = x[4*i + 3] * x[4*i + 3];
+
+        x2_max = fmaxf(x2_max, x0);
+        x2_max = fmaxf(x2_max, x1);
+        x2_max = fmaxf(x2_max, x2);
+        x2_max = fmaxf(x2_max, x3);
+
+        e[i] = x0 + x1 + x2 + x3;
+    }
+
+    return x2_max;
+}
+
+#endif /* block_energies */
+
 /**
  * Global Gain Estimation
  * dt, sr          Duration and samplerate of the frame
@@ -85,7 +119,8 @@ LC3_HOT static int estimate_gain(
     bool *reset_off, int *g_min)
 {
     int n4 = lc3_ne(dt, sr) / 4;
-    union { float f; int32_t q16; } e[LC3_MAX_NE / 4];
+    float e[LC3_MAX_NE / 4];
+    int32_t e_q16[LC3_MAX_NE / 4];
 
     /* --- Signal adaptative noise floor --- */
 
@@ -117,28 +152,14 @@ LC3_HOT static int estimate_gain(
 
     /* --- Energy (dB) by 4 MDCT blocks --- */
 
-    float x2_max = 0;
-
-    for (int i = 0; i < n4; i++) {
-        float x0 = x[4*i + 0] * x[4*i + 0];
-        float x1 = x[4*i + 1] * x[4*i + 1];
-        float x2 = x[4*i + 2] * x[4*i + 2];
-        float x3 = x[4*i + 3] * x[4*i + 3];
-
-        x2_max = fmaxf(x2_max, x0);
-        x2_max = fmaxf(x2_max, x1);
-        x2_max = fmaxf(x2_max, x2);
-        x2_max = fmaxf(x2_max, x3);
-
-        e[i].f = x0 + x1 + x2 + x3;
-    }
-
-    float x_max = sqrtf(x2_max);
+    float x_max = sqrtf(block_energies(x, n4, e));
     float nf = lc3_hr(sr) ?
         lc3_ldexpf(x_max, -reg_bits) * lc3_exp2f(-low_bits) : 0;
 
     for (int i = 0; i < n4; i++)
-        e[i].q16 = lc3_db_q16(fmaxf(e[i].f + nf, 1e-10f));
+        e[i] = fmaxf(e[i] + nf, 1e-10f);
+
+    lc3_db_q16_array(e, e_q16, n4);
 
     /* --- Determine gain index --- */
 
@@ -153,10 +174,10 @@ LC3_HOT static int estimate_gain(
         int gn = (g_int - i) * k_20_28;
         int v = 0;
 
-        for (j = j0; j >= 0 && e[j].q16 < gn; j--);
+        for (j = j0; j >= 0 && e_q16[j] < gn; j--);
 
         for (j1 = j; j >= 0; j--) {
-            int e_diff = e[j].q16 - gn;
+            int e_diff = e_q16[j] - gn;
 
             v += e_diff < 0 ? k_2u7 :
                  e_diff < 43 << 16 ?   e_diff + ( 7 << 16)
@@ -241,6 +262,28 @@ LC3_HOT static int adjust_gain(
     return 0;
 }
 
+/**
+ * Scale coefficients, and locate the last significant pair
+ * x, n            Spectral coefficients, scaled as output, and count
+ * g               Scale factor
+ * xq_min          Minimum magnitude of a significant coefficient
+ * return          Count of coefficients, up to the last significant pair
+ */
+#ifndef scale_significants
+
+LC3_HOT static int scale_significants(float *x, int n, float g, float xq_min)
+{
+    for (int i = 0; i < n; i++)
+        x[i] *= g;
+
+    while (n >= 2 && fabsf(x[n-1]) < xq_min && fabsf(x[n-2]) < xq_min)
+        n -= 2;
+
+    return n;
+}
+
+#endif /* scale_significants */
+
 /**
  * Spectrum quantization
  * dt, sr          Duration and samplerate of the frame
@@ -252,19 +295,9 @@ LC3_HOT static void quantize(
     enum lc3_dt dt, enum lc3_srate sr, int g_int, float *x, int *n)
 {
     float g_inv = unquantize_gain(-g_int);
-    int ne = lc3_ne(dt, sr);
-
-    *n = ne;
-
-    for (int i = 0; i < ne; i += 2) {
-        float xq_min = lc3_hr(sr) ? 0.5f : 10.f/16;
+    float xq_min = lc3_hr(sr) ? 0.5f : 10.f/16;
 
-        x[i+0] *= g_inv;
-        x[i+1] *= g_inv;
-
-        *n = fabsf(x[i+0]) >= xq_min ||
-             fabsf(x[i+1]) >= xq_min   ? ne : *n - 2;
-    }
+    *n = scale_significants(x, lc3_ne(dt, sr), g_inv, xq_min);
 }
 
 /**
@@ -273,21 +306,19 @@ LC3_HOT static void quantize(
  * g_int           Quantization gain value
  * x, nq           Spectral quantized, and count of significants
  * return          Unquantized gain value
+ *
+ * The coefficients are left unscaled, the gain is applied
+ * within the following pass of TNS synthesis.
  */
 LC3_HOT static float unquantize(
     enum lc3_dt dt, enum lc3_srate sr,
     int g_int, float *x, int nq)
 {
-    float g = unquantize_gain(g_int);
-    int i, ne = lc3_ne(dt, sr);
-
-    for (i = 0; i < nq; i++)
-        x[i] = x[i] * g;
+    int ne = lc3_ne(dt, sr);
 
-    for ( ; i < ne; i++)
-        x[i] = 0;
+    memset(x + nq, 0, (ne - nq) * sizeof(float));
 
-    return g;
+    return unquantize_gain(g_int);
 }
 
 
@@ -409,6 +440,23 @@ LC3_HOT static int compute_nbits(
     return (nbits_end + 2047) / 2048;
 }
 
+/**
+ * Interleave the bits of 2 values
+ * a, b            Values, on 16 bits
+ * return          Bits of `a` and `b` on even and odd positions
+ */
+static inline uint32_t interleave_bits(uint32_t a, uint32_t b)
+{
+    uint32_t v = a | (b << 16);
+
+    v = (v & 0xff0000ff) | ((v >> 8) & 0x0000ff00) | ((v << 8) & 0x00ff0000);
+    v = (v & 0xf00ff00f) | ((v >> 4) & 0x00f000f0) | ((v << 4) & 0x0f000f00);
+    v = (v & 0xc3c3c3c3) | ((v >> 2) & 0x0c0c0c0c) | ((v << 2) & 0x30303030);
+    v = (v & 0x99999999) | ((v >> 1) & 0x22222222) | ((v << 1) & 0x44444444);
+
+    return v;
+}
+
 /**
  * Put quantized spectrum
  * bits            Bitstream context
@@ -446,30 +494,47 @@ LC3_HOT static void put_quantized(lc3_bits_t *bits,
             uint32_t m = (a | b) >> 2;
             unsigned k = 0, shr = 0;
 
+            uint32_t v = 0;
+            int nv = 0;
+
             if (m) {
 
                 if (lsb_mode)
                     lc3_put_symbol(bits,
                         lc3_spectrum_models + lut[k++], 16);
 
-                for (m >>= lsb_mode; m; m >>= 1, k++) {
-                    lc3_put_bit(bits, (a >> k) & 1);
-                    lc3_put_bit(bits, (b >> k) & 1);
+                for (m >>= lsb_mode; m; m >>= 1, k++)
                     lc3_put_symbol(bits,
                         lc3_spectrum_models + lut[LC3_MIN(k, 3)], 16);
-                }
 
                 a >>= lsb_mode;
                 b >>= lsb_mode;
 
                 shr = k - lsb_mode;
                 k = LC3_MIN(k, 3);
+
+                /* The LSB pairs are written at once, as plain bits are
+                 * independent of the arithmetic coded escape symbols.
+                 * Only the last 15 pairs are kept, to add the signs. */
+
+                uint32_t la = a, lb = b;
+
+                for (nv = shr; nv > 15; nv -= 8, la >>= 8, lb >>= 8)
+                    lc3_put_bits(bits,
+                        interleave_bits(la & 0xff, lb & 0xff), 16);
+
+                v = interleave_bits(
+                    la & ((1u << nv) - 1), lb & ((1u << nv) - 1));
+                nv *= 2;
             }
 
             /* --- Sign values --- */
 
-            if (a) lc3_put_bit(bits, x[i+0] < 0);
-            if (b) lc3_put_bit(bits, x[i+1] < 0);
+            if (a) v |= (uint32_t)(x[i+0] < 0) << (nv++);
+            if (b) v |= (uint32_t)(x[i+1] < 0) << (nv++);
+
+            if (nv)
+                lc3_put_bits(bits, v, nv);
 
             /* --- MSB values --- */
 
@@ -740,16 +805,18 @@ LC3_HOT static int estimate_noise(
  * Noise filling
  * dt, bw          Duration and bandwidth of the frame
  * nf, nf_seed     The noise factor and pseudo-random seed
- * g               Quantization gain
  * x, nq           Spectral quantized, and count of significants
+ *
+ * The noise level is given before the quantization gain, the exact
+ * scaling by 1/16 commutes with the application of the gain.
  */
 LC3_HOT static void fill_noise(enum lc3_dt dt, enum lc3_bandwidth bw,
-    int nf, uint16_t nf_seed, float g, float *x, int nq)
+    int nf, uint16_t nf_seed, float *x, int nq)
 {
     int bw_stop = lc3_ne(dt, (enum lc3_srate)LC3_MIN(bw, LC3_BANDWIDTH_FB));
     int w = 1 + (dt >= LC3_DT_7M5) + (dt>= LC3_DT_10M);
 
-    float s = g * (float)(8 - nf) / 16;
+    float s = (float)(8 - nf) / 16;
     int i, z = 0;
 
     for (i = 6 * (1 + dt) - w; i < LC3_MIN(nq, bw_stop); i++) {
@@ -929,7 +996,7 @@ int lc3_spec_get_side(lc3_bits_t *bits,
  */
 int lc3_spec_decode(lc3_bits_t *bits,
     enum lc3_dt dt, enum lc3_srate sr, enum lc3_bandwidth bw,
-    int nbytes, const lc3_spec_side_t *side, float *x)
+    int nbytes, const lc3_spec_side_t *side, float *x, float *g)
 {
     bool lsb_mode = side->lsb_mode;
     int nq = side->nq;
@@ -950,10 +1017,10 @@ int lc3_spec_decode(lc3_bits_t *bits,
         get_residual(bits, nbits_left, lc3_hr(sr), x, nq);
 
     int g_int = side->g_idx - resolve_gain_offset(sr, nbytes);
-    float g = unquantize(dt, sr, g_int, x, nq);
+    *g = unquantize(dt, sr, g_int, x, nq);
 
     if (nq > 2 || x[0] || x[1] || side->g_idx > 0 || nf < 7)
-        fill_noise(dt, bw, nf, nf_seed, g, x, nq);
+        fill_noise(dt, bw, nf, nf_seed, x, nq);
 
     return 0;
 }
@@ -94,12 +94,13 @@ int lc3_spec_get_side(lc3_bits_t *bits,
  * dt, sr, bw      Duration, samplerate, bandwidth
  * nbytes          and size of the frame
  * side            Quantization side data
- * x               Spectral coefficients
+ * x               Spectral coefficients, before application of the gain
+ * g               Return the quantization gain
  * return          0: Ok  -1: Invalid bitstream data
  */
 int lc3_spec_decode(lc3_bits_t *bits,
     enum lc3_dt dt, enum lc3_srate sr, enum lc3_bandwidth bw,
-    int nbytes, const lc3_spec_side_t *side, float *x);
+    int nbytes, const lc3_spec_side_t *side, float *x, float *g);
 
 
 #endif /* __LC3_SPEC_H */
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+/**
+ * Energy of blocks of 4 coefficients, on 4 blocks at a time
+ * The coefficients of the blocks are deinterleaved by the loads,
+ * and the squares are summed in the order of the generic code.
+ */
+#ifndef block_energies
+
+LC3_HOT static float neon_block_energies(const float *x, int n4, float *e)
+{
+    float32x4_t x2_max = vdupq_n_f32(0);
+    int i = 0;
+
+    for ( ; i + 4 <= n4; i += 4) {
+        float32x4x4_t xi = vld4q_f32(x + 4*i);
+
+        float32x4_t x0 = vmulq_f32(xi.val[0], xi.val[0]);
+        float32x4_t x1 = vmulq_f32(xi.val[1], xi.val[1]);
+        float32x4_t x2 = vmulq_f32(xi.val[2], xi.val[2]);
+        float32x4_t x3 = vmulq_f32(xi.val[3], xi.val[3]);
+
+        x2_max = vmaxnmq_f32(x2_max,
+            vmaxnmq_f32(vmaxnmq_f32(x0, x1), vmaxnmq_f32(x2, x3)));
+
+        vst1q_f32(e + i, vaddq_f32(vaddq_f32(vaddq_f32(x0, x1), x2), x3));
+    }
+
+    float x2_max_s = vmaxnmvq_f32(x2_max);
+
+    for ( ; i < n4; i++) {
+        float x0 = x[4*i + 0] * x[4*i + 0];
+        float x1 = x[4*i + 1] * x[4*i + 1];
+        float x2 = x[4*i + 2] * x[4*i + 2];
+        float x3 = x[4*i + 3] * x[4*i + 3];
+
+        x2_max_s = fmaxf(x2_max_s, fmaxf(fmaxf(x0, x1), fmaxf(x2, x3)));
+        e[i] = x0 + x1 + x2 + x3;
+    }
+
+    return x2_max_s;
+}
+
+#ifndef TEST_NEON
+#define block_energies neon_block_energies
+#endif
+
+#endif /* block_energies */
+
+
+/**
+ * Scale coefficients, and locate the last significant pair,
+ * on 4 values at a time
+ */
+#ifndef scale_significants
+
+LC3_HOT static int neon_scale_significants(
+    float *x, int n, float g, float xq_min)
+{
+    int i = 0, i_last = -1;
+
+    for ( ; i + 4 <= n; i += 4) {
+        float32x4_t xi = vmulq_n_f32(vld1q_f32(x + i), g);
+        vst1q_f32(x + i, xi);
+
+        uint32x4_t m = vcageq_f32(xi, vdupq_n_f32(xq_min));
+        if (vmaxvq_u32(m))
+            i_last = i + 3 - (vgetq_lane_u32(m, 3) ? 0 :
+                              vgetq_lane_u32(m, 2) ? 1 :
+                              vgetq_lane_u32(m, 1) ? 2 : 3 );
+    }
+
+    for ( ; i < n; i++) {
+        x[i] *= g;
+        if (fabsf(x[i]) >= xq_min)
+            i_last = i;
+    }
+
+    return (i_last & ~1) + 2;
+}
+
+#ifndef TEST_NEON
+#define scale_significants neon_scale_significants
+#endif
+
+#endif /* scale_significants */
+
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
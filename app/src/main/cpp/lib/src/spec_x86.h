@@ -0,0 +1,76 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __SSE__ && !defined(TEST_NEON)
+
+#include <immintrin.h>
+
+
+/**
+ * Scale coefficients, and locate the last significant pair,
+ * on 4 or 8 values at a time
+ */
+#ifndef scale_significants
+
+LC3_HOT static int x86_scale_significants(
+    float *x, int n, float g, float xq_min)
+{
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    int i = 0, i_last = -1;
+
+#if __AVX__
+    const __m256 abs_mask_256 = _mm256_castsi256_ps(
+        _mm256_set1_epi32(0x7fffffff));
+
+    for ( ; i + 8 <= n; i += 8) {
+        __m256 xi = _mm256_mul_ps(_mm256_loadu_ps(x + i), _mm256_set1_ps(g));
+        _mm256_storeu_ps(x + i, xi);
+
+        __m256 ai = _mm256_and_ps(xi, abs_mask_256);
+        int m = _mm256_movemask_ps(
+            _mm256_cmp_ps(ai, _mm256_set1_ps(xq_min), _CMP_GE_OQ));
+        if (m)
+            i_last = i + 31 - __builtin_clz(m);
+    }
+#endif /* __AVX__ */
+
+    for ( ; i + 4 <= n; i += 4) {
+        __m128 xi = _mm_mul_ps(_mm_loadu_ps(x + i), _mm_set1_ps(g));
+        _mm_storeu_ps(x + i, xi);
+
+        int m = _mm_movemask_ps(_mm_cmpge_ps(
+            _mm_and_ps(xi, abs_mask), _mm_set1_ps(xq_min)));
+        if (m)
+            i_last = i + 31 - __builtin_clz(m);
+    }
+
+    for ( ; i < n; i++) {
+        x[i] *= g;
+        if (fabsf(x[i]) >= xq_min)
+            i_last = i;
+    }
+
+    return (i_last & ~1) + 2;
+}
+
+#define scale_significants x86_scale_significants
+
+#endif /* scale_significants */
+
+
+#endif /* __SSE__ */
@@ -82,6 +82,8 @@ const int lc3_frame_bytes_hr_lim
  *     cos(-2Pi * 2i/N) + j sin(-2Pi * 2i/N) } , N=15, 45
  */
 
+#if !LC3_RUNTIME_TABLES
+
 static const struct lc3_fft_bf3_twiddles fft_twiddles_15 = {
     .n3 = 15/3, .t = (const struct lc3_complex [][2]){
         { {  1.0000000e+0, -0.0000000e+0 }, {  1.0000000e+0, -0.0000000e+0 } },
@@ -152,6 +154,18 @@ static const struct lc3_fft_bf3_twiddles fft_twiddles_45 = {
     }
 };
 
+#else /* LC3_RUNTIME_TABLES */
+
+#define __LC3_FFT_BF3_TWIDDLES(_n) \
+    static struct lc3_complex fft_twiddles_ ## _n ## _t[_n][2]; \
+    static const struct lc3_fft_bf3_twiddles fft_twiddles_ ## _n = \
+        { .n3 = _n/3, .t = fft_twiddles_ ## _n ## _t }
+
+__LC3_FFT_BF3_TWIDDLES(15);
+__LC3_FFT_BF3_TWIDDLES(45);
+
+#endif /* LC3_RUNTIME_TABLES */
+
 const struct lc3_fft_bf3_twiddles *lc3_fft_twiddles_bf3[] =
     { &fft_twiddles_15, &fft_twiddles_45 };
 
@@ -163,6 +177,8 @@ const struct lc3_fft_bf3_twiddles *lc3_fft_twiddles_bf3[] =
  *   cos(-2Pi * i/N) + j sin(-2Pi * i/N) , N=10, 20, ...
  */
 
+#if !LC3_RUNTIME_TABLES
+
 static const struct lc3_fft_bf2_twiddles fft_twiddles_10 = {
     .n2 = 10/2, .t = (const struct lc3_complex []){
         {  1.0000000e+00, -0.0000000e+00 }, {  8.0901699e-01, -5.8778525e-01 },
@@ -606,6 +622,30 @@ static const struct lc3_fft_bf2_twiddles fft_twiddles_480 = {
 
 #endif /* LC3_PLUS_HR */
 
+#else /* LC3_RUNTIME_TABLES */
+
+#define __LC3_FFT_BF2_TWIDDLES(_n) \
+    static struct lc3_complex fft_twiddles_ ## _n ## _t[_n/2]; \
+    static const struct lc3_fft_bf2_twiddles fft_twiddles_ ## _n = \
+        { .n2 = _n/2, .t = fft_twiddles_ ## _n ## _t }
+
+__LC3_FFT_BF2_TWIDDLES( 10);
+__LC3_FFT_BF2_TWIDDLES( 20);
+__LC3_FFT_BF2_TWIDDLES( 30);
+__LC3_FFT_BF2_TWIDDLES( 40);
+__LC3_FFT_BF2_TWIDDLES( 60);
+__LC3_FFT_BF2_TWIDDLES( 80);
+__LC3_FFT_BF2_TWIDDLES( 90);
+__LC3_FFT_BF2_TWIDDLES(120);
+__LC3_FFT_BF2_TWIDDLES(160);
+__LC3_FFT_BF2_TWIDDLES(180);
+__LC3_FFT_BF2_TWIDDLES(240);
+#if LC3_PLUS_HR
+__LC3_FFT_BF2_TWIDDLES(480);
+#endif
+
+#endif /* LC3_RUNTIME_TABLES */
+
 const struct lc3_fft_bf2_twiddles *lc3_fft_twiddles_bf2[][3] = {
     { &fft_twiddles_10 , &fft_twiddles_30 , &fft_twiddles_90  },
     { &fft_twiddles_20 , &fft_twiddles_60 , &fft_twiddles_180 },
@@ -622,6 +662,8 @@ const struct lc3_fft_bf2_twiddles *lc3_fft_twiddles_bf2[][3] = {
  *   W[n] = e                   * sqrt( sqrt( 4/N ) ), n = [0..N/4-1]
  */
 
+#if !LC3_RUNTIME_TABLES
+
 #if LC3_PLUS
 
 static const struct lc3_mdct_rot_def mdct_rot_40 = {
@@ -1445,6 +1487,32 @@ static const struct lc3_mdct_rot_def mdct_rot_1920 = {
 
 #endif /* LC3_PLUS_HR */
 
+#else /* LC3_RUNTIME_TABLES */
+
+#define __LC3_MDCT_ROT(_n) \
+    static struct lc3_complex mdct_rot_ ## _n ## _w[_n/4]; \
+    static const struct lc3_mdct_rot_def mdct_rot_ ## _n = \
+        { .n4 = _n/4, .w = mdct_rot_ ## _n ## _w }
+
+#if LC3_PLUS
+__LC3_MDCT_ROT(  40);
+__LC3_MDCT_ROT(  80);
+#endif
+__LC3_MDCT_ROT( 120);
+__LC3_MDCT_ROT( 160);
+__LC3_MDCT_ROT( 240);
+__LC3_MDCT_ROT( 320);
+__LC3_MDCT_ROT( 360);
+__LC3_MDCT_ROT( 480);
+__LC3_MDCT_ROT( 640);
+__LC3_MDCT_ROT( 720);
+__LC3_MDCT_ROT( 960);
+#if LC3_PLUS_HR
+__LC3_MDCT_ROT(1920);
+#endif
+
+#endif /* LC3_RUNTIME_TABLES */
+
 const struct lc3_mdct_rot_def * lc3_mdct_rot[LC3_NUM_DT][LC3_NUM_SRATE] = {
 
     [LC3_DT_2M5] = {
@@ -1468,6 +1536,102 @@ const struct lc3_mdct_rot_def * lc3_mdct_rot[LC3_NUM_DT][LC3_NUM_SRATE] = {
 };
 
 
+/**
+ * Runtime generation of the twiddles and MDCT rotation tables
+ */
+
+#if LC3_RUNTIME_TABLES
+
+#include <stdatomic.h>
+
+/**
+ * Round to 8 significant digits, as printed in the static tables
+ */
+static float round_8d(double x)
+{
+    if (x == 0)
+        return x;
+
+    double m = pow(10, 7 - floor(log10(fabs(x))));
+    return round(x * m) / m;
+}
+
+/**
+ * Complex exponential `s e^(j 2Pi k/n)`, evaluated in double precision
+ */
+static struct lc3_complex expj(double k, int n, double s)
+{
+    const double pi = 3.14159265358979323846;
+    double a = 2 * pi * k / n;
+
+    return (struct lc3_complex){
+        .re = round_8d(s * cos(a)), .im = round_8d(s * sin(a)) };
+}
+
+static void setup_fft_bf3_twiddles(const struct lc3_fft_bf3_twiddles *tw)
+{
+    struct lc3_complex (*t)[2] = (struct lc3_complex (*)[2])tw->t;
+    int n = 3 * tw->n3;
+
+    for (int i = 0; i < n; i++) {
+        t[i][0] = expj(-(double)   i , n, 1);
+        t[i][1] = expj(-(double)(2*i), n, 1);
+    }
+}
+
+static void setup_fft_bf2_twiddles(const struct lc3_fft_bf2_twiddles *tw)
+{
+    struct lc3_complex *t = (struct lc3_complex *)tw->t;
+    int n = 2 * tw->n2;
+
+    for (int i = 0; i < n/2; i++)
+        t[i] = expj(-(double)i, n, 1);
+}
+
+static void setup_mdct_rot(const struct lc3_mdct_rot_def *rot)
+{
+    struct lc3_complex *w = (struct lc3_complex *)rot->w;
+    int n = 4 * rot->n4;
+
+    for (int i = 0; i < n/4; i++)
+        w[i] = expj(i + 0.125, n, sqrt(sqrt(4. / n)));
+}
+
+/**
+ * Generate the tables used by a plan
+ *
+ * A table is left untouched once filled, that is told by its first
+ * coefficient, never zero. The generation is serialized, so that the
+ * tables are filled on return, whatever the concurrent setups.
+ */
+void lc3_setup_tables(const struct lc3_plan *plan)
+{
+    static atomic_flag lock = ATOMIC_FLAG_INIT;
+
+    while (atomic_flag_test_and_set_explicit(&lock, memory_order_acquire));
+
+    if (plan->mdct_rot->w[0].re == 0)
+        setup_mdct_rot(plan->mdct_rot);
+
+    /* Walk the stages of the FFT of `ns / 2` points,
+     * following the decomposition done by the transform */
+
+    int n = plan->ns / 2 / 5, i2, i3;
+
+    for (i3 = 0; n & (n-1); i3++, n /= 3)
+        if (lc3_fft_twiddles_bf3[i3]->t[0][0].re == 0)
+            setup_fft_bf3_twiddles(lc3_fft_twiddles_bf3[i3]);
+
+    for (i2 = 0; n > 1; i2++, n >>= 1)
+        if (lc3_fft_twiddles_bf2[i2][i3]->t[0].re == 0)
+            setup_fft_bf2_twiddles(lc3_fft_twiddles_bf2[i2][i3]);
+
+    atomic_flag_clear_explicit(&lock, memory_order_release);
+}
+
+#endif /* LC3_RUNTIME_TABLES */
+
+
 /**
  * Low delay MDCT windows
  */
@@ -4397,6 +4561,78 @@ const int lc3_num_bands[LC3_NUM_DT][LC3_NUM_SRATE] = {
         LC3_IF_PLUS_HR( __LC3_NUM_BANDS( band_lim_10m_96k_hr ), 0 ) },
 };
 
+
+/**
+ * Plans of configurations
+ */
+
+#define __LC3_PLAN(_dt, _sr, _dt_us, _sr_hz, _ne_hz, _name, _rot) \
+    [_dt][_sr] = { \
+        .dt = _dt, .sr = _sr, \
+        .ns = LC3_NS(_dt_us, _sr_hz), .ne = LC3_NS(_dt_us, _ne_hz), \
+        .nd = LC3_ND(_dt_us, _sr_hz), .nh = LC3_NH(_dt_us, _sr_hz), \
+        .nt = LC3_NT(_sr_hz), \
+        .nb = __LC3_NUM_BANDS(band_lim_ ## _name), \
+        .band_lim = band_lim_ ## _name, \
+        .mdct_win = mdct_win_ ## _name, \
+        .mdct_rot = &mdct_rot_ ## _rot }
+
+const struct lc3_plan lc3_plans[LC3_NUM_DT][LC3_NUM_SRATE] = {
+
+#if LC3_PLUS
+
+    __LC3_PLAN(LC3_DT_2M5, LC3_SRATE_8K ,  2500,  8000,  8000, 2m5_8k ,  40),
+    __LC3_PLAN(LC3_DT_2M5, LC3_SRATE_16K,  2500, 16000, 16000, 2m5_16k,  80),
+    __LC3_PLAN(LC3_DT_2M5, LC3_SRATE_24K,  2500, 24000, 24000, 2m5_24k, 120),
+    __LC3_PLAN(LC3_DT_2M5, LC3_SRATE_32K,  2500, 32000, 32000, 2m5_32k, 160),
+    __LC3_PLAN(LC3_DT_2M5, LC3_SRATE_48K,  2500, 48000, 40000, 2m5_48k, 240),
+
+    __LC3_PLAN(LC3_DT_5M , LC3_SRATE_8K ,  5000,  8000,  8000, 5m_8k  ,  80),
+    __LC3_PLAN(LC3_DT_5M , LC3_SRATE_16K,  5000, 16000, 16000, 5m_16k , 160),
+    __LC3_PLAN(LC3_DT_5M , LC3_SRATE_24K,  5000, 24000, 24000, 5m_24k , 240),
+    __LC3_PLAN(LC3_DT_5M , LC3_SRATE_32K,  5000, 32000, 32000, 5m_32k , 320),
+    __LC3_PLAN(LC3_DT_5M , LC3_SRATE_48K,  5000, 48000, 40000, 5m_48k , 480),
+
+#if LC3_PLUS_HR
+
+    __LC3_PLAN(LC3_DT_2M5, LC3_SRATE_48K_HR,
+                2500, 48000, 48000, 2m5_48k_hr,  240),
+    __LC3_PLAN(LC3_DT_2M5, LC3_SRATE_96K_HR,
+                2500, 96000, 96000, 2m5_96k_hr,  480),
+
+    __LC3_PLAN(LC3_DT_5M , LC3_SRATE_48K_HR,
+                5000, 48000, 48000, 5m_48k_hr ,  480),
+    __LC3_PLAN(LC3_DT_5M , LC3_SRATE_96K_HR,
+                5000, 96000, 96000, 5m_96k_hr ,  960),
+
+#endif /* LC3_PLUS_HR */
+#endif /* LC3_PLUS */
+
+    __LC3_PLAN(LC3_DT_7M5, LC3_SRATE_8K ,  7500,  8000,  8000, 7m5_8k , 120),
+    __LC3_PLAN(LC3_DT_7M5, LC3_SRATE_16K,  7500, 16000, 16000, 7m5_16k, 240),
+    __LC3_PLAN(LC3_DT_7M5, LC3_SRATE_24K,  7500, 24000, 24000, 7m5_24k, 360),
+    __LC3_PLAN(LC3_DT_7M5, LC3_SRATE_32K,  7500, 32000, 32000, 7m5_32k, 480),
+    __LC3_PLAN(LC3_DT_7M5, LC3_SRATE_48K,  7500, 48000, 40000, 7m5_48k, 720),
+
+    __LC3_PLAN(LC3_DT_10M, LC3_SRATE_8K , 10000,  8000,  8000, 10m_8k , 160),
+    __LC3_PLAN(LC3_DT_10M, LC3_SRATE_16K, 10000, 16000, 16000, 10m_16k, 320),
+    __LC3_PLAN(LC3_DT_10M, LC3_SRATE_24K, 10000, 24000, 24000, 10m_24k, 480),
+    __LC3_PLAN(LC3_DT_10M, LC3_SRATE_32K, 10000, 32000, 32000, 10m_32k, 640),
+    __LC3_PLAN(LC3_DT_10M, LC3_SRATE_48K, 10000, 48000, 40000, 10m_48k, 960),
+
+#if LC3_PLUS_HR
+
+    __LC3_PLAN(LC3_DT_10M, LC3_SRATE_48K_HR,
+               10000, 48000, 48000, 10m_48k_hr,  960),
+    __LC3_PLAN(LC3_DT_10M, LC3_SRATE_96K_HR,
+               10000, 96000, 96000, 10m_96k_hr, 1920),
+
+#endif /* LC3_PLUS_HR */
+
+};
+
+#undef __LC3_PLAN
+
 #undef __LC3_NUM_BANDS
 
 
@@ -114,6 +114,46 @@ extern const int lc3_num_bands[LC3_NUM_DT][LC3_NUM_SRATE];
 extern const int *lc3_band_lim[LC3_NUM_DT][LC3_NUM_SRATE];
 
 
+/**
+ * Plan of a configuration
+ * The sizes and tables of a frame duration and samplerate, resolved once
+ * and shared read-only by all the encoders and decoders of the
+ * configuration.
+ */
+
+struct lc3_plan {
+    enum lc3_dt dt;
+    enum lc3_srate sr;
+
+    int ns, ne, nd, nh, nt;
+    int nb;
+
+    const int *band_lim;
+    const float *mdct_win;
+    const struct lc3_mdct_rot_def *mdct_rot;
+};
+
+extern const struct lc3_plan lc3_plans[LC3_NUM_DT][LC3_NUM_SRATE];
+
+static inline const struct lc3_plan *lc3_plan(
+    enum lc3_dt dt, enum lc3_srate sr) {
+    return &lc3_plans[dt][sr];
+}
+
+/**
+ * Generate the twiddles and rotation tables used by the MDCT of a plan
+ * The tables are filled once, and shared by all the plans using them.
+ * Without effect when the tables are built statically.
+ */
+
+#if LC3_RUNTIME_TABLES
+void lc3_setup_tables(const struct lc3_plan *plan);
+#else
+static inline void lc3_setup_tables(const struct lc3_plan *plan)
+    { (void)plan; }
+#endif
+
+
 /**
  * SNS Quantization
  */
@@ -19,6 +19,9 @@
 #include "tns.h"
 #include "tables.h"
 
+#include "tns_neon.h"
+#include "tns_arm.h"
+
 
 /* ----------------------------------------------------------------------------
  *  Filter Coefficients
@@ -35,20 +38,30 @@ static bool resolve_lpc_weighting(enum lc3_dt dt, int nbytes)
 }
 
 /**
- * Return dot product of 2 vectors
- * a, b, n         The 2 vectors of size `n`
- * return          sum( a[i] * b[i] ), i = [0..n-1]
+ * Autocorrelation of a vector
+ * x, n            The vector of size `n`
+ * maxorder        Maximum lag of the autocorrelation
+ * r               Return sum( x[i] * x[i+k] ), i = [0..n-k-1],
+ *                 for the lags k = [0..maxorder]
  */
-LC3_HOT static inline float dot(const float *a, const float *b, int n)
+#ifndef autocorrelate
+
+LC3_HOT static void autocorrelate(
+    const float *x, int n, int maxorder, float *r)
 {
-    float v = 0;
+    for (int k = 0; k <= maxorder; k++) {
+        const float *a = x, *b = x + k;
+        float v = 0;
 
-    while (n--)
-        v += *(a++) * *(b++);
+        for (int i = k; i < n; i++)
+            v += *(a++) * *(b++);
 
-    return v;
+        r[k] = v;
+    }
 }
 
+#endif /* autocorrelate */
+
 /**
  * LPC Coefficients
  * dt, bw          Duration and bandwidth of the frame
@@ -128,27 +141,25 @@ LC3_HOT static void compute_lpc_coeffs(
     float r[2][9];
 
     for (int f = 0; f < nfilters; f++) {
-        float c[9][3] = { 0 };
+        float c[3][9];
 
         for (int s = 0; s < nsubdivisions; s++) {
             xs = xe, xe = x + *(++sub);
-
-            for (int k = 0; k <= maxorder; k++)
-                c[k][s] = dot(xs, xs + k, (xe - xs) - k);
+            autocorrelate(xs, xe - xs, maxorder, c[s]);
         }
 
         r[f][0] = nsubdivisions;
         if (nsubdivisions == 2) {
-            float e0 = c[0][0], e1 = c[0][1];
+            float e0 = c[0][0], e1 = c[1][0];
             for (int k = 1; k <= maxorder; k++)
                 r[f][k] = e0 == 0 || e1 == 0 ? 0 :
-                  (c[k][0]/e0 + c[k][1]/e1) * lag_window[k];
+                  (c[0][k]/e0 + c[1][k]/e1) * lag_window[k];
 
         } else {
-            float e0 = c[0][0], e1 = c[0][1], e2 = c[0][2];
+            float e0 = c[0][0], e1 = c[1][0], e2 = c[2][0];
             for (int k = 1; k <= maxorder; k++)
                 r[f][k] = e0 == 0 || e1 == 0 || e2 == 0 ? 0 :
-                  (c[k][0]/e0 + c[k][1]/e1 + c[k][2]/e2) * lag_window[k];
+                  (c[0][k]/e0 + c[1][k]/e1 + c[2][k]/e2) * lag_window[k];
         }
     }
 
@@ -298,6 +309,8 @@ static void unquantize_rc(const int *rc_q, int order, float rc[8])
  * rc_order, rc    Order of coefficients, and coefficients
  * x               Spectral coefficients, filtered as output
  */
+#ifndef forward_filtering
+
 LC3_HOT static void forward_filtering(
     enum lc3_dt dt, enum lc3_bandwidth bw,
     const int rc_order[2], float (* const rc)[8], float *x)
@@ -334,44 +347,66 @@ LC3_HOT static void forward_filtering(
     }
 }
 
+#endif /* forward_filtering */
+
 /**
- * Inverse filtering
- * dt, bw          Duration and bandwidth of the frame
- * rc_order, rc    Order of coefficients, and unquantized coefficients
- * x               Spectral coefficients, filtered as output
+ * TNS inverse filtering, and scaling of the spectrum
+ * dt, sr, bw      Duration, samplerate and bandwidth
+ * rc_order, rc    Order of coefficients, and coefficients
+ * g, g_sns        Gains applied before filtering, and by bands after
+ * x, y            Spectral coefficients, and filtered output
+ *
+ * The coefficients are processed in a single pass, by bands
+ * split at the boundaries of the filters.
  */
 LC3_HOT static void inverse_filtering(
-    enum lc3_dt dt, enum lc3_bandwidth bw,
-    const int rc_order[2], float (* const rc)[8], float *x)
+    enum lc3_dt dt, enum lc3_srate sr, enum lc3_bandwidth bw,
+    const int rc_order[2], float (* const rc)[8],
+    float g, const float *g_sns, const float *x, float *y)
 {
     int nfilters = 1 + (dt >= LC3_DT_5M && bw >= LC3_BANDWIDTH_SWB);
     int nf = lc3_ne(dt, (enum lc3_srate)LC3_MIN(bw, LC3_BANDWIDTH_FB))
                 >> (nfilters - 1);
-    int i0, ie = 3*(1 + dt);
+    int ne = lc3_ne(dt, sr);
+    const int *lim = lc3_band_lim[dt][sr];
 
     float s[8] = { 0 };
+    int i = 0, ib = 0;
 
-    for (int f = 0; f < nfilters; f++) {
+    for (int f = -1; f <= nfilters; f++) {
 
-        i0 = ie;
-        ie = nf * (1 + f);
+        int ie = f < 0 ? 3*(1 + (int)dt) : f < nfilters ? nf * (1 + f) : ne;
+        bool active = f >= 0 && f < nfilters && rc_order[f];
 
-        if (!rc_order[f])
-            continue;
+        for ( ; i < ie; ib += (i == lim[ib+1])) {
+            int ie_b = LC3_MIN(ie, lim[ib+1]);
 
-        for (int i = i0; i < ie; i++) {
-            float xi = x[i];
+            /* The gain is applied by a first loop on the segment, and the
+             * shaping gain by a last one, so that the products cannot be
+             * regrouped, as done by `-ffast-math`, nor fused in FMA */
+
+            int i0 = i;
+
+            for ( ; i < ie_b; i++)
+                y[i] = x[i] * g;
 
-            xi -= s[7] * rc[f][7];
-            for (int k = 6; k >= 0; k--) {
-                xi -= s[k] * rc[f][k];
-                s[k+1] = s[k] + rc[f][k] * xi;
+            for (i = i0; active && i < ie_b; i++) {
+                float xi = y[i];
+
+                xi -= s[7] * rc[f][7];
+                for (int k = 6; k >= 0; k--) {
+                    xi -= s[k] * rc[f][k];
+                    s[k+1] = s[k] + rc[f][k] * xi;
+                }
+                s[0] = xi;
+                y[i] = xi;
             }
-            s[0] = xi;
-            x[i] = xi;
+
+            for (i = i0; i < ie_b; i++)
+                y[i] *= g_sns[ib];
         }
 
-        for (int k = 7; k >= rc_order[f]; k--)
+        for (int k = 7; active && k >= rc_order[f]; k--)
             s[k] = 0;
     }
 }
@@ -424,8 +459,10 @@ void lc3_tns_analyze(enum lc3_dt dt, enum lc3_bandwidth bw,
 /**
  * TNS synthesis
  */
-void lc3_tns_synthesize(enum lc3_dt dt, enum lc3_bandwidth bw,
-    const struct lc3_tns_data *data, float *x)
+void lc3_tns_synthesize(
+    enum lc3_dt dt, enum lc3_srate sr, enum lc3_bandwidth bw,
+    const struct lc3_tns_data *data, float g, const float *g_sns,
+    const float *x, float *y)
 {
     float rc[2][8] = { 0 };
 
@@ -433,7 +470,7 @@ void lc3_tns_synthesize(enum lc3_dt dt, enum lc3_bandwidth bw,
         if (data->rc_order[f])
             unquantize_rc(data->rc[f], data->rc_order[f], rc[f]);
 
-    inverse_filtering(dt, bw, data->rc_order, rc, x);
+    inverse_filtering(dt, sr, bw, data->rc_order, rc, g, g_sns, x, y);
 }
 
 /**
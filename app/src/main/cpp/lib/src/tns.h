@@ -81,13 +81,17 @@ int lc3_tns_get_data(lc3_bits_t *bits,
     enum lc3_dt dt, enum lc3_bandwidth bw, int nbytes, lc3_tns_data_t *data);
 
 /**
- * TNS synthesis
- * dt, bw          Duration and bandwidth of the frame
+ * TNS synthesis, and scaling of the spectrum
+ * dt, sr, bw      Duration, samplerate and bandwidth of the frame
  * data            Bitstream data
- * x               Spectral coefficients, filtered as output
+ * g               Global gain, applied on coefficients before filtering
+ * g_sns           Gains of the bands, applied after filtering
+ * x, y            Spectral coefficients, and filtered output
  */
-void lc3_tns_synthesize(enum lc3_dt dt, enum lc3_bandwidth bw,
-    const lc3_tns_data_t *data, float *x);
+void lc3_tns_synthesize(
+    enum lc3_dt dt, enum lc3_srate sr, enum lc3_bandwidth bw,
+    const lc3_tns_data_t *data, float g, const float *g_sns,
+    const float *x, float *y);
 
 
 #endif /* __LC3_TNS_H */
@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if (__ARM_FEATURE_SIMD32 && !(__GNUC__ < 10) && LC3_FIXED_TNS || \
+        defined(TEST_ARM))
+
+#ifndef TEST_ARM
+#include <arm_acle.h>
+#endif /* TEST_ARM */
+
+
+/**
+ * Forward filtering, in fixed point
+ *
+ * The filtered coefficients are scaled by a single power of 2, leaving
+ * as headroom the bound of the gain of the lattice, the product of the
+ * `1 + |rc|` terms, up to 8 bits. The reflection coefficients are Q15
+ * values, packed by pairs and selected by the 32x16 bits multiplications
+ * (SMULWB / SMULWT).
+ *
+ * The result is not bit-exact with the generic version: the error is
+ * bounded to a few units of 2^-30 of the largest filtered coefficient,
+ * times the gain bound.
+ */
+#ifndef forward_filtering
+
+LC3_HOT static void arm_forward_filtering(
+    enum lc3_dt dt, enum lc3_bandwidth bw,
+    const int rc_order[2], float (* const rc)[8], float *x)
+{
+    int nfilters = 1 + (dt >= LC3_DT_5M && bw >= LC3_BANDWIDTH_SWB);
+    int nf = lc3_ne(dt, (enum lc3_srate)LC3_MIN(bw, LC3_BANDWIDTH_FB))
+                >> (nfilters - 1);
+    int i0, ie;
+
+    /* --- Scale of the filtered coefficients --- */
+
+    float xmax = 0, rmax[8] = { 0 };
+
+    ie = 3*(1 + (int)dt);
+
+    for (int f = 0; f < nfilters; f++) {
+
+        i0 = ie;
+        ie = nf * (1 + f);
+
+        for (int k = 0; k < rc_order[f]; k++)
+            rmax[k] = LC3_MAX(rmax[k], LC3_ABS(rc[f][k]));
+
+        for (int i = i0; rc_order[f] && i < ie; i++)
+            xmax = LC3_MAX(xmax, LC3_ABS(x[i]));
+    }
+
+    if (xmax <= 0)
+        return;
+
+    float g = 1.f;
+
+    for (int k = 0; k < 8; k++)
+        g *= 1.f + rmax[k];
+
+    int e, h;
+    frexpf(xmax, &e);
+    frexpf(g, &h);
+
+    float scale = ldexpf(1.f, 30 - h - e);
+    float inv_scale = ldexpf(1.f, e + h - 30);
+
+    /* --- Filtering --- */
+
+    int32_t s[8] = { 0 };
+
+    ie = 3*(1 + (int)dt);
+
+    for (int f = 0; f < nfilters; f++) {
+
+        i0 = ie;
+        ie = nf * (1 + f);
+
+        int order = rc_order[f];
+        if (!order)
+            continue;
+
+        int16_t q[8] = { 0 };
+        int16x2_t r[4];
+
+        for (int k = 0; k < order; k++)
+            q[k] = (int16_t)(rc[f][k] * 0x1p15f);
+
+        for (int k = 0; k < 4; k++)
+            r[k] = (int16x2_t)( (uint32_t)(uint16_t)q[2*k+0] |
+                               ((uint32_t)(uint16_t)q[2*k+1] << 16) );
+
+        for (int i = i0; i < ie; i++) {
+            int32_t xi = (int32_t)(x[i] * scale);
+            int32_t s0, s1 = xi;
+            int k = 0;
+
+            for ( ; k + 1 < order; k += 2) {
+                int16x2_t rk = r[k >> 1];
+
+                s0 = s[k];
+                s[k] = s1;
+
+                s1  = s0 + 2 * __smulwb(xi, rk);
+                xi += 2 * __smulwb(s0, rk);
+
+                s0 = s[k+1];
+                s[k+1] = s1;
+
+                s1  = s0 + 2 * __smulwt(xi, rk);
+                xi += 2 * __smulwt(s0, rk);
+            }
+
+            if (k < order) {
+                s0 = s[k];
+                s[k] = s1;
+
+                xi += 2 * __smulwb(s0, r[k >> 1]);
+            }
+
+            x[i] = (float)xi * inv_scale;
+        }
+    }
+}
+
+#ifndef TEST_ARM
+#define forward_filtering arm_forward_filtering
+#endif
+
+#endif /* forward_filtering */
+
+
+#endif /* __ARM_FEATURE_SIMD32 */
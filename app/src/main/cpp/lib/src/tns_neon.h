@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+/**
+ * Autocorrelation of a vector
+ * The lags are accumulated by lanes, in the order of the samples, so that
+ * the results are the ones of the sequential dot products.
+ */
+#ifndef autocorrelate
+
+LC3_HOT static void neon_autocorrelate(
+    const float *x, int n, int maxorder, float *r)
+{
+    float32x4_t r0 = vdupq_n_f32(0), r1 = vdupq_n_f32(0);
+    float rn = 0;
+    int i = 0;
+
+    if (maxorder > 4) {
+        for ( ; i < n - 8; i++) {
+            r0 = vfmaq_n_f32(r0, vld1q_f32(x + i    ), x[i]);
+            r1 = vfmaq_n_f32(r1, vld1q_f32(x + i + 4), x[i]);
+            rn += x[i] * x[i + 8];
+        }
+
+        vst1q_f32(r + 4, r1);
+
+    } else {
+        for ( ; i < n - 4; i++) {
+            r0 = vfmaq_n_f32(r0, vld1q_f32(x + i), x[i]);
+            rn += x[i] * x[i + 4];
+        }
+    }
+
+    vst1q_f32(r, r0);
+    r[maxorder] = rn;
+
+    for ( ; i < n; i++)
+        for (int k = 0; k <= maxorder && k < n - i; k++)
+            r[k] += x[i] * x[i + k];
+}
+
+#ifndef TEST_NEON
+#define autocorrelate neon_autocorrelate
+#endif
+
+#endif /* autocorrelate */
+
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
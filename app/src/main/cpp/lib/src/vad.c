@@ -0,0 +1,77 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "vad.h"
+#include "tables.h"
+
+
+/**
+ * Voice activity detection
+ */
+bool lc3_vad_run(enum lc3_dt dt, enum lc3_srate sr,
+    lc3_vad_analysis_t *vad, const float *e, float nc, float *level)
+{
+    int nb = lc3_num_bands[dt][sr];
+    const int *lim = lc3_band_lim[dt][sr];
+
+    /* --- Level of the frame, relative to 16 bits full scale --- */
+
+    float ex = 0;
+    for (int i = 0; i < nb; i++)
+        ex += e[i] * (lim[i+1] - lim[i]);
+
+    ex /= lim[nb];
+    *level = 10 * log10f(ex * 0x1p-30f + 1e-12f);
+
+    /* --- Noise floor tracking ---
+     * Minimum of the level over the current window of 120 ms, and the
+     * previous ones, up to 600 ms. The floor follows the level down
+     * immediately, and rises to a stationary noise within 600 ms.
+     * The zero initial state starts the windows from the full scale. */
+
+    vad->min = LC3_MIN(vad->min, *level);
+
+    float floor = vad->min;
+    for (int i = 0; i < LC3_VAD_NWIN; i++)
+        floor = LC3_MIN(floor, vad->win_min[i]);
+
+    if (++vad->count >= 48 / (1 + (int)dt)) {
+        memmove(vad->win_min + 1, vad->win_min,
+            (LC3_VAD_NWIN - 1) * sizeof(*vad->win_min));
+
+        vad->win_min[0] = vad->min;
+        vad->min = 0;
+        vad->count = 0;
+    }
+
+    /* --- Decision ---
+     * A frame is active when well above the floor, or when voiced
+     * and slightly above. The floor is limited to the -60 dBFS gate,
+     * under which no frame is active. The decision is held for 100 ms. */
+
+    float snr = *level - LC3_MAX(floor, -60.f);
+
+    bool active = *level > -60.f && (snr > 10.f || (nc > 0.7f && snr > 3.f));
+
+    if (active)
+        vad->hangover = 40 / (1 + dt);
+    else if (vad->hangover > 0)
+        vad->hangover--, active = true;
+
+    return active;
+}
@@ -0,0 +1,41 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#ifndef __LC3_VAD_H
+#define __LC3_VAD_H
+
+#include "common.h"
+
+
+/**
+ * Voice activity detection
+ * dt, sr          Duration and samplerate of the frame
+ * vad             Context of the detector
+ * e               Energy estimation per bands
+ * nc              Normalized correlation of the pitch, 0 when not present
+ * level           Return the level of the frame, in dB relative to full scale
+ * return          1: Activity detected  0: Otherwise
+ *
+ * The level is compared to a tracked noise floor, and the decision
+ * is held for 100 ms after the last active frame.
+ */
+bool lc3_vad_run(enum lc3_dt dt, enum lc3_srate sr,
+    lc3_vad_analysis_t *vad, const float *e, float nc, float *level);
+
+
+#endif /* __LC3_VAD_H */
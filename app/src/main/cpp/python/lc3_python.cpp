@@ -0,0 +1,627 @@
+/**
+ * LC3 Python扩展（基于 lc3_cpp.h，纯C++，不依赖JNI）
+ *
+ * 一次调用编解码整段PCM，支持单声道或交织的多声道，以及全部PCM格式。
+ * 输入输出均通过缓冲区协议访问（NumPy数组、bytes、bytearray、memoryview等），
+ * 可直接写入预先分配的数组而不产生拷贝。编解码期间释放GIL，
+ * 因此不同的编解码器实例可在多个Python线程中并行处理不同的片段；
+ * threads 参数大于1时，单次调用内按声道并行。
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <thread>
+#include <vector>
+
+#include "lc3_cpp.h"
+
+namespace {
+
+// 按声道访问 lc3_cpp.h 编解码器的状态
+class Encoder : public lc3::Encoder {
+public:
+    Encoder(int dtUs, int srHz, int srPcmHz, int channels, bool hrmode)
+        : lc3::Encoder(dtUs, srHz, srPcmHz, channels, hrmode) {}
+
+    bool valid() const { return nchannels_ > 0 && states.size() == nchannels_; }
+    int channels() const { return (int)nchannels_; }
+    bool hrmode() const { return hrmode_; }
+    int frameBytes(int bitrate) const { return lc3_hr_frame_bytes(hrmode_, dt_us_, sr_hz_, bitrate); }
+    lc3_encoder_t state(int ich) { return states[ich].get(); }
+};
+
+class Decoder : public lc3::Decoder {
+public:
+    Decoder(int dtUs, int srHz, int srPcmHz, int channels, bool hrmode)
+        : lc3::Decoder(dtUs, srHz, srPcmHz, channels, hrmode) {}
+
+    bool valid() const { return nchannels_ > 0 && states.size() == nchannels_; }
+    int channels() const { return (int)nchannels_; }
+    bool hrmode() const { return hrmode_; }
+    lc3_decoder_t state(int ich) { return states[ich].get(); }
+};
+
+// PCM格式：名称、缓冲区协议格式字符与每个采样的字节数
+struct PcmFormat {
+    const char* name;
+    char code;
+    int size;
+    enum lc3_pcm_format fmt;
+};
+
+const PcmFormat kFormats[] = {
+    { "s16",     'h', 2, LC3_PCM_FORMAT_S16     },
+    { "s24",     'i', 4, LC3_PCM_FORMAT_S24     },
+    { "s24_3le", 'B', 3, LC3_PCM_FORMAT_S24_3LE },
+    { "float",   'f', 4, LC3_PCM_FORMAT_FLOAT   },
+};
+
+// 按名称查找格式，名称为NULL时由缓冲区的格式字符推断（int16、int32、float32）
+const PcmFormat* findFormat(const char* name, const Py_buffer* view) {
+    if (name != NULL) {
+        for (const PcmFormat& f : kFormats)
+            if (strcmp(name, f.name) == 0)
+                return &f;
+
+        PyErr_Format(PyExc_ValueError, "unknown PCM format '%s'", name);
+        return NULL;
+    }
+
+    const char* code = view->format != NULL ? view->format : "B";
+    if (strchr("@=<", code[0]) != NULL)
+        code++;
+
+    char c = code[1] == '\0' ? code[0] : 0;
+    if (c == 'l' && view->itemsize == 4)
+        c = 'i';
+
+    for (const PcmFormat& f : kFormats)
+        if (c == f.code && f.code != 'B' && view->itemsize == f.size)
+            return &f;
+
+    PyErr_SetString(PyExc_ValueError,
+                    "cannot infer the PCM format of the buffer, set 'fmt'");
+    return NULL;
+}
+
+// 在 threads 个线程上处理各声道，声道0所在的一组在当前线程处理
+template <typename F>
+void runChannels(int channels, int threads, F fn) {
+    int nt = threads < channels ? threads : channels;
+    if (nt <= 1) {
+        for (int ich = 0; ich < channels; ich++)
+            fn(ich);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    for (int it = 1; it < nt; it++)
+        workers.emplace_back([&, it] {
+            for (int ich = it; ich < channels; ich += nt)
+                fn(ich);
+        });
+
+    for (int ich = 0; ich < channels; ich += nt)
+        fn(ich);
+
+    for (std::thread& w : workers)
+        w.join();
+}
+
+// 获取可写的输出缓冲区，out 为None时分配 bytearray
+bool getOutput(PyObject** out, Py_ssize_t size, Py_buffer* view) {
+    if (*out == Py_None) {
+        *out = PyByteArray_FromStringAndSize(NULL, size);
+        if (*out == NULL)
+            return false;
+    } else {
+        Py_INCREF(*out);
+    }
+
+    if (PyObject_GetBuffer(*out, view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+        Py_CLEAR(*out);
+        return false;
+    }
+
+    if (view->len < size) {
+        PyErr_Format(PyExc_ValueError,
+                     "output buffer too small: %zd bytes, %zd needed", view->len, size);
+        PyBuffer_Release(view);
+        Py_CLEAR(*out);
+        return false;
+    }
+
+    return true;
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Encoder
+ * -------------------------------------------------------------------------- */
+
+struct PyEncoder {
+    PyObject_HEAD
+    Encoder* encoder;
+    bool busy;
+};
+
+int PyEncoder_init(PyEncoder* self, PyObject* args, PyObject* kwargs) {
+    static const char* kwlist[] = {
+        "dt_us", "sr_hz", "channels", "sr_pcm_hz", "hrmode", NULL };
+
+    int dtUs, srHz, channels = 1, srPcmHz = 0, hrmode = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ii|iip", (char**)kwlist,
+                                     &dtUs, &srHz, &channels, &srPcmHz, &hrmode))
+        return -1;
+
+    // 编解码在释放GIL后进行，此时不能释放其状态
+    if (self->busy) {
+        PyErr_SetString(PyExc_RuntimeError, "encoder in use");
+        return -1;
+    }
+
+    delete self->encoder;
+    self->encoder = NULL;
+
+    Encoder* encoder = new Encoder(dtUs, srHz, srPcmHz, channels > 0 ? channels : 0, hrmode);
+    if (!encoder->valid()) {
+        delete encoder;
+        PyErr_SetString(PyExc_ValueError, "invalid encoder parameters");
+        return -1;
+    }
+
+    self->encoder = encoder;
+    return 0;
+}
+
+void PyEncoder_dealloc(PyEncoder* self) {
+    delete self->encoder;
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+PyObject* PyEncoder_encode(PyEncoder* self, PyObject* args, PyObject* kwargs) {
+    static const char* kwlist[] = {
+        "pcm", "frame_bytes", "out", "fmt", "threads", NULL };
+
+    PyObject* pcmObj;
+    PyObject* out = Py_None;
+    const char* fmtName = NULL;
+    int frameBytes, threads = 1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "Oi|Ozi", (char**)kwlist,
+                                     &pcmObj, &frameBytes, &out, &fmtName, &threads))
+        return NULL;
+
+    Encoder* encoder = self->encoder;
+    if (encoder == NULL || self->busy) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        encoder == NULL ? "encoder not initialized" : "encoder in use");
+        return NULL;
+    }
+
+    if (frameBytes < LC3_MIN_FRAME_BYTES
+            || frameBytes > (encoder->hrmode() ? LC3_HR_MAX_FRAME_BYTES : LC3_MAX_FRAME_BYTES)) {
+        PyErr_Format(PyExc_ValueError, "invalid frame size %d", frameBytes);
+        return NULL;
+    }
+
+    Py_buffer in;
+    if (PyObject_GetBuffer(pcmObj, &in, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0)
+        return NULL;
+
+    const PcmFormat* f = findFormat(fmtName, &in);
+    if (f == NULL) {
+        PyBuffer_Release(&in);
+        return NULL;
+    }
+
+    int nch = encoder->channels();
+    int ns = encoder->GetFrameSamples();
+    Py_ssize_t blockSize = (Py_ssize_t)ns * nch * f->size;
+
+    // 多维数组的形状为(采样数, 声道数)，s24_3le 格式为(采样数, 声道数, 3)
+    bool shaped = in.ndim <= 1 || (in.shape[1] == nch && (in.ndim == 2
+        || (in.ndim == 3 && f->fmt == LC3_PCM_FORMAT_S24_3LE && in.shape[2] == 3)));
+
+    if (in.len % blockSize != 0 || !shaped) {
+        PyErr_Format(PyExc_ValueError,
+                     "PCM of %zd bytes is not a whole number of %d channels frames",
+                     in.len, nch);
+        PyBuffer_Release(&in);
+        return NULL;
+    }
+
+    int nframes = (int)(in.len / blockSize);
+
+    Py_buffer outView;
+    if (!getOutput(&out, (Py_ssize_t)nframes * nch * frameBytes, &outView)) {
+        PyBuffer_Release(&in);
+        return NULL;
+    }
+
+    // 输出每帧依次为各声道的编码数据，每个声道 frameBytes 字节
+    const uint8_t* pcm = (const uint8_t*)in.buf;
+    uint8_t* data = (uint8_t*)outView.buf;
+    std::vector<int> rets(nch, 0);
+
+    self->busy = true;
+    Py_BEGIN_ALLOW_THREADS
+
+    runChannels(nch, threads, [&](int ich) {
+        lc3_encoder_t state = encoder->state(ich);
+        if (nch == 1) {
+            std::vector<uint8_t> scratch(lc3_encoder_frames_scratch_size(state));
+            rets[ich] = lc3_encode_frames(state, f->fmt, pcm, 1, frameBytes, data, nframes,
+                                          scratch.data());
+            return;
+        }
+
+        for (int i = 0; i < nframes; i++)
+            rets[ich] |= lc3_encode(state, f->fmt,
+                pcm + ((size_t)i * ns * nch + ich) * f->size, nch,
+                frameBytes, data + ((size_t)i * nch + ich) * frameBytes);
+    });
+
+    Py_END_ALLOW_THREADS
+    self->busy = false;
+
+    PyBuffer_Release(&outView);
+    PyBuffer_Release(&in);
+
+    for (int ret : rets) {
+        if (ret != 0) {
+            Py_DECREF(out);
+            PyErr_SetString(PyExc_RuntimeError, "encoding failed");
+            return NULL;
+        }
+    }
+
+    return out;
+}
+
+PyObject* PyEncoder_reset(PyEncoder* self, PyObject*) {
+    if (self->busy) {
+        PyErr_SetString(PyExc_RuntimeError, "encoder in use");
+        return NULL;
+    }
+
+    if (self->encoder != NULL)
+        self->encoder->Reset();
+    Py_RETURN_NONE;
+}
+
+PyObject* PyEncoder_frame_bytes(PyEncoder* self, PyObject* arg) {
+    int bitrate = PyLong_AsLong(arg);
+    if (bitrate == -1 && PyErr_Occurred())
+        return NULL;
+    return PyLong_FromLong(self->encoder ? self->encoder->frameBytes(bitrate) : -1);
+}
+
+PyObject* PyEncoder_get_channels(PyEncoder* self, void*) {
+    return PyLong_FromLong(self->encoder ? self->encoder->channels() : 0);
+}
+
+PyObject* PyEncoder_get_frame_samples(PyEncoder* self, void*) {
+    return PyLong_FromLong(self->encoder ? self->encoder->GetFrameSamples() : 0);
+}
+
+PyObject* PyEncoder_get_delay_samples(PyEncoder* self, void*) {
+    return PyLong_FromLong(self->encoder ? self->encoder->GetDelaySamples() : 0);
+}
+
+PyMethodDef PyEncoder_methods[] = {
+    { "encode", (PyCFunction)(void(*)(void))PyEncoder_encode, METH_VARARGS | METH_KEYWORDS,
+      "encode(pcm, frame_bytes, out=None, fmt=None, threads=1)\n"
+      "编码整数帧的PCM（单声道，或按采样交织的多声道，二维数组的形状为(采样数, 声道数)）。\n"
+      "fmt 为 's16'、's24'、's24_3le' 或 'float'，默认由数组类型推断（int16、int32、float32）。\n"
+      "每帧依次输出各声道 frame_bytes 字节；out 为可写缓冲区时直接写入并返回 out，\n"
+      "否则返回新的 bytearray。threads 大于1时按声道并行。" },
+    { "reset", (PyCFunction)PyEncoder_reset, METH_NOARGS,
+      "reset()\n重置编码器状态，开始新的片段。" },
+    { "frame_bytes", (PyCFunction)PyEncoder_frame_bytes, METH_O,
+      "frame_bytes(bitrate)\n每个声道每帧的字节数，由比特率（每声道）计算。" },
+    { NULL }
+};
+
+PyGetSetDef PyEncoder_getset[] = {
+    { "channels", (getter)PyEncoder_get_channels, NULL, "声道数", NULL },
+    { "frame_samples", (getter)PyEncoder_get_frame_samples, NULL, "每个声道的单帧采样数", NULL },
+    { "delay_samples", (getter)PyEncoder_get_delay_samples, NULL, "算法延迟（采样数）", NULL },
+    { NULL }
+};
+
+PyTypeObject PyEncoderType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+};
+
+
+/* ----------------------------------------------------------------------------
+ *  Decoder
+ * -------------------------------------------------------------------------- */
+
+struct PyDecoder {
+    PyObject_HEAD
+    Decoder* decoder;
+    bool busy;
+    int concealed;
+};
+
+int PyDecoder_init(PyDecoder* self, PyObject* args, PyObject* kwargs) {
+    static const char* kwlist[] = {
+        "dt_us", "sr_hz", "channels", "sr_pcm_hz", "hrmode", NULL };
+
+    int dtUs, srHz, channels = 1, srPcmHz = 0, hrmode = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ii|iip", (char**)kwlist,
+                                     &dtUs, &srHz, &channels, &srPcmHz, &hrmode))
+        return -1;
+
+    // 编解码在释放GIL后进行，此时不能释放其状态
+    if (self->busy) {
+        PyErr_SetString(PyExc_RuntimeError, "decoder in use");
+        return -1;
+    }
+
+    delete self->decoder;
+    self->decoder = NULL;
+
+    Decoder* decoder = new Decoder(dtUs, srHz, srPcmHz, channels > 0 ? channels : 0, hrmode);
+    if (!decoder->valid()) {
+        delete decoder;
+        PyErr_SetString(PyExc_ValueError, "invalid decoder parameters");
+        return -1;
+    }
+
+    self->decoder = decoder;
+    self->concealed = 0;
+    return 0;
+}
+
+void PyDecoder_dealloc(PyDecoder* self) {
+    delete self->decoder;
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+PyObject* PyDecoder_decode(PyDecoder* self, PyObject* args, PyObject* kwargs) {
+    static const char* kwlist[] = {
+        "data", "frame_bytes", "out", "fmt", "threads", "nframes", NULL };
+
+    PyObject* dataObj;
+    PyObject* out = Py_None;
+    const char* fmtName = NULL;
+    int frameBytes, threads = 1, nframes = -1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "Oi|Ozii", (char**)kwlist,
+                                     &dataObj, &frameBytes, &out, &fmtName,
+                                     &threads, &nframes))
+        return NULL;
+
+    Decoder* decoder = self->decoder;
+    if (decoder == NULL || self->busy) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        decoder == NULL ? "decoder not initialized" : "decoder in use");
+        return NULL;
+    }
+
+    if (frameBytes < LC3_MIN_FRAME_BYTES
+            || frameBytes > (decoder->hrmode() ? LC3_HR_MAX_FRAME_BYTES : LC3_MAX_FRAME_BYTES)) {
+        PyErr_Format(PyExc_ValueError, "invalid frame size %d", frameBytes);
+        return NULL;
+    }
+
+    // 输出格式未指定时，由 out 的类型推断
+    Py_buffer in = {};
+    Py_buffer outView;
+    const PcmFormat* f = NULL;
+    int nch = decoder->channels();
+    int ns = decoder->GetFrameSamples();
+
+    if (out != Py_None && fmtName == NULL) {
+        if (PyObject_GetBuffer(out, &outView, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0)
+            return NULL;
+        f = findFormat(NULL, &outView);
+        PyBuffer_Release(&outView);
+    } else {
+        f = findFormat(fmtName != NULL ? fmtName : "s16", NULL);
+    }
+
+    if (f == NULL)
+        return NULL;
+
+    // data 为None时对 nframes 帧执行PLC
+    if (dataObj != Py_None) {
+        if (PyObject_GetBuffer(dataObj, &in, PyBUF_C_CONTIGUOUS) < 0)
+            return NULL;
+
+        if (in.len % ((Py_ssize_t)nch * frameBytes) != 0) {
+            PyErr_Format(PyExc_ValueError,
+                         "data of %zd bytes is not a whole number of %d channels frames",
+                         in.len, nch);
+            PyBuffer_Release(&in);
+            return NULL;
+        }
+
+        nframes = (int)(in.len / ((Py_ssize_t)nch * frameBytes));
+
+    } else if (nframes < 0) {
+        PyErr_SetString(PyExc_ValueError, "'nframes' is needed to conceal frames");
+        return NULL;
+    }
+
+    bool allocated = out == Py_None;
+    Py_ssize_t outSize = (Py_ssize_t)nframes * ns * nch * f->size;
+
+    if (!getOutput(&out, outSize, &outView)) {
+        if (in.obj != NULL)
+            PyBuffer_Release(&in);
+        return NULL;
+    }
+
+    const uint8_t* data = (const uint8_t*)in.buf;
+    uint8_t* pcm = (uint8_t*)outView.buf;
+    std::vector<int> rets(nch, 0);
+
+    self->busy = true;
+    Py_BEGIN_ALLOW_THREADS
+
+    runChannels(nch, threads, [&](int ich) {
+        lc3_decoder_t state = decoder->state(ich);
+        if (nch == 1) {
+            std::vector<uint8_t> scratch(lc3_decoder_frames_scratch_size(state));
+            rets[ich] = lc3_decode_frames(state, data, frameBytes, f->fmt, pcm, 1, nframes,
+                                          scratch.data());
+            return;
+        }
+
+        for (int i = 0; i < nframes; i++) {
+            int ret = lc3_decode(state,
+                data != NULL ? data + ((size_t)i * nch + ich) * frameBytes : NULL,
+                frameBytes, f->fmt, pcm + ((size_t)i * ns * nch + ich) * f->size, nch);
+            rets[ich] = ret < 0 ? ret : rets[ich] < 0 ? rets[ich] : rets[ich] + ret;
+        }
+    });
+
+    Py_END_ALLOW_THREADS
+    self->busy = false;
+
+    PyBuffer_Release(&outView);
+    if (in.obj != NULL)
+        PyBuffer_Release(&in);
+
+    self->concealed = 0;
+    for (int ret : rets) {
+        if (ret < 0) {
+            Py_DECREF(out);
+            PyErr_SetString(PyExc_RuntimeError, "decoding failed");
+            return NULL;
+        }
+        self->concealed += ret;
+    }
+
+    if (!allocated)
+        return out;
+
+    // 新分配的输出以形状为(采样数, 声道数)的 memoryview 返回，可由 numpy.asarray() 零拷贝访问
+    PyObject* view = PyMemoryView_FromObject(out);
+    Py_DECREF(out);
+    if (view == NULL)
+        return NULL;
+
+    PyObject* shape = f->fmt == LC3_PCM_FORMAT_S24_3LE
+        ? Py_BuildValue("(nii)", (Py_ssize_t)nframes * ns, nch, 3)
+        : Py_BuildValue("(ni)", (Py_ssize_t)nframes * ns, nch);
+    PyObject* cast = shape != NULL
+        ? PyObject_CallMethod(view, "cast", "CO", f->code, shape) : NULL;
+
+    Py_XDECREF(shape);
+    Py_DECREF(view);
+    return cast;
+}
+
+PyObject* PyDecoder_reset(PyDecoder* self, PyObject*) {
+    if (self->busy) {
+        PyErr_SetString(PyExc_RuntimeError, "decoder in use");
+        return NULL;
+    }
+
+    if (self->decoder != NULL)
+        self->decoder->Reset();
+    Py_RETURN_NONE;
+}
+
+PyObject* PyDecoder_get_channels(PyDecoder* self, void*) {
+    return PyLong_FromLong(self->decoder ? self->decoder->channels() : 0);
+}
+
+PyObject* PyDecoder_get_frame_samples(PyDecoder* self, void*) {
+    return PyLong_FromLong(self->decoder ? self->decoder->GetFrameSamples() : 0);
+}
+
+PyObject* PyDecoder_get_delay_samples(PyDecoder* self, void*) {
+    return PyLong_FromLong(self->decoder ? self->decoder->GetDelaySamples() : 0);
+}
+
+PyObject* PyDecoder_get_concealed(PyDecoder* self, void*) {
+    return PyLong_FromLong(self->concealed);
+}
+
+PyMethodDef PyDecoder_methods[] = {
+    { "decode", (PyCFunction)(void(*)(void))PyDecoder_decode, METH_VARARGS | METH_KEYWORDS,
+      "decode(data, frame_bytes, out=None, fmt=None, threads=1, nframes=-1)\n"
+      "解码整数帧的编码数据（布局与 Encoder.encode() 的输出一致），输出交织的PCM。\n"
+      "data 为None时对 nframes 帧执行PLC。out 为可写缓冲区时直接写入并返回 out，\n"
+      "fmt 未指定时由 out 的类型推断；否则返回新分配的形状为(采样数, 声道数)的\n"
+      "memoryview，fmt 默认为 's16'。threads 大于1时按声道并行。" },
+    { "reset", (PyCFunction)PyDecoder_reset, METH_NOARGS,
+      "reset()\n重置解码器状态，开始新的片段。" },
+    { NULL }
+};
+
+PyGetSetDef PyDecoder_getset[] = {
+    { "channels", (getter)PyDecoder_get_channels, NULL, "声道数", NULL },
+    { "frame_samples", (getter)PyDecoder_get_frame_samples, NULL, "每个声道的单帧采样数", NULL },
+    { "delay_samples", (getter)PyDecoder_get_delay_samples, NULL, "算法延迟（采样数）", NULL },
+    { "concealed", (getter)PyDecoder_get_concealed, NULL,
+      "上一次 decode() 中执行PLC的帧数（各声道累计）", NULL },
+    { NULL }
+};
+
+PyTypeObject PyDecoderType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+};
+
+
+/* ----------------------------------------------------------------------------
+ *  Module
+ * -------------------------------------------------------------------------- */
+
+PyModuleDef lc3Module = {
+    PyModuleDef_HEAD_INIT,
+    "lc3",
+    "LC3编解码（基于 lc3_cpp.h），整段PCM一次编解码，支持缓冲区协议与并行处理。",
+    -1,
+};
+
+} // namespace
+
+PyMODINIT_FUNC PyInit_lc3(void) {
+    PyEncoderType.tp_name = "lc3.Encoder";
+    PyEncoderType.tp_doc = "Encoder(dt_us, sr_hz, channels=1, sr_pcm_hz=0, hrmode=False)";
+    PyEncoderType.tp_basicsize = sizeof(PyEncoder);
+    PyEncoderType.tp_flags = Py_TPFLAGS_DEFAULT;
+    PyEncoderType.tp_new = PyType_GenericNew;
+    PyEncoderType.tp_init = (initproc)PyEncoder_init;
+    PyEncoderType.tp_dealloc = (destructor)PyEncoder_dealloc;
+    PyEncoderType.tp_methods = PyEncoder_methods;
+    PyEncoderType.tp_getset = PyEncoder_getset;
+
+    PyDecoderType.tp_name = "lc3.Decoder";
+    PyDecoderType.tp_doc = "Decoder(dt_us, sr_hz, channels=1, sr_pcm_hz=0, hrmode=False)";
+    PyDecoderType.tp_basicsize = sizeof(PyDecoder);
+    PyDecoderType.tp_flags = Py_TPFLAGS_DEFAULT;
+    PyDecoderType.tp_new = PyType_GenericNew;
+    PyDecoderType.tp_init = (initproc)PyDecoder_init;
+    PyDecoderType.tp_dealloc = (destructor)PyDecoder_dealloc;
+    PyDecoderType.tp_methods = PyDecoder_methods;
+    PyDecoderType.tp_getset = PyDecoder_getset;
+
+    if (PyType_Ready(&PyEncoderType) < 0 || PyType_Ready(&PyDecoderType) < 0)
+        return NULL;
+
+    PyObject* module = PyModule_Create(&lc3Module);
+    if (module == NULL)
+        return NULL;
+
+    Py_INCREF(&PyEncoderType);
+    Py_INCREF(&PyDecoderType);
+    if (PyModule_AddObject(module, "Encoder", (PyObject*)&PyEncoderType) < 0
+            || PyModule_AddObject(module, "Decoder", (PyObject*)&PyDecoderType) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    return module;
+}
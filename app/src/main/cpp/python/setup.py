@@ -0,0 +1,26 @@
+# LC3 Python扩展的构建脚本，使用本机Python构建：
+#
+#   python3 setup.py build_ext --inplace
+#
+# 生成的 lc3 模块包含完整的LC3库，不依赖其他动态库。
+
+import glob
+import os
+
+from setuptools import Extension, setup
+
+os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+setup(
+    name='lc3',
+    version='1.0',
+    description='LC3 codec bindings, on top of lc3_cpp.h',
+    ext_modules=[
+        Extension(
+            'lc3',
+            sources=['lc3_python.cpp'] + sorted(glob.glob('../lib/src/*.c')),
+            include_dirs=['../lib/include'],
+            extra_compile_args=['-O3'],
+        ),
+    ],
+)
@@ -13,6 +13,8 @@ class LC3Codec {
         
         // PCM格式常量
         const val PCM_FORMAT_S16 = 0
+        const val PCM_FORMAT_S24 = 1
+        const val PCM_FORMAT_FLOAT = 3
         
         // 常用帧长（微秒）
         const val FRAME_DURATION_10MS = 10000
@@ -124,6 +126,96 @@ class LC3Codec {
         return decode(decoderHandle, inputBuffer, frameBytes, outputBuffer, outputSize)
     }
     
+    /**
+     * 编码多帧16位PCM数据
+     * @param pcm 输入PCM采样，至少 frames * getFrameSamplesCount() 个
+     * @param outputBuffer 输出编码数据，至少 frames * getEncodedBytesCount() 字节
+     * @param frames 帧数
+     * @return 0表示成功，-1表示失败
+     */
+    fun encode(pcm: ShortArray, outputBuffer: ByteArray, frames: Int = 1): Int {
+        if (encoderHandle == 0L) {
+            return -1
+        }
+        
+        return encodeShorts(encoderHandle, pcm, frameSamples, frames, frameBytes, outputBuffer)
+    }
+    
+    /**
+     * 编码多帧24位PCM数据（PCM_FORMAT_S24，每个采样使用Int的低24位）
+     * @param pcm 输入PCM采样，至少 frames * getFrameSamplesCount() 个
+     * @param outputBuffer 输出编码数据，至少 frames * getEncodedBytesCount() 字节
+     * @param frames 帧数
+     * @return 0表示成功，-1表示失败
+     */
+    fun encode(pcm: IntArray, outputBuffer: ByteArray, frames: Int = 1): Int {
+        if (encoderHandle == 0L) {
+            return -1
+        }
+        
+        return encodeInts(encoderHandle, pcm, frameSamples, frames, frameBytes, outputBuffer)
+    }
+    
+    /**
+     * 编码多帧浮点PCM数据（PCM_FORMAT_FLOAT，范围-1到1）
+     * @param pcm 输入PCM采样，至少 frames * getFrameSamplesCount() 个
+     * @param outputBuffer 输出编码数据，至少 frames * getEncodedBytesCount() 字节
+     * @param frames 帧数
+     * @return 0表示成功，-1表示失败
+     */
+    fun encode(pcm: FloatArray, outputBuffer: ByteArray, frames: Int = 1): Int {
+        if (encoderHandle == 0L) {
+            return -1
+        }
+        
+        return encodeFloats(encoderHandle, pcm, frameSamples, frames, frameBytes, outputBuffer)
+    }
+    
+    /**
+     * 解码多帧数据为16位PCM
+     * @param inputBuffer 输入编码数据，为null时每一帧都执行PLC
+     * @param pcm 输出PCM采样，至少 frames * getFrameSamplesCount() 个
+     * @param frames 帧数
+     * @return 0表示成功，1表示至少一帧执行了PLC，-1表示失败
+     */
+    fun decode(inputBuffer: ByteArray?, pcm: ShortArray, frames: Int = 1): Int {
+        if (decoderHandle == 0L) {
+            return -1
+        }
+        
+        return decodeShorts(decoderHandle, inputBuffer, frameBytes, pcm, frameSamples, frames)
+    }
+    
+    /**
+     * 解码多帧数据为24位PCM（PCM_FORMAT_S24，符号扩展到32位）
+     * @param inputBuffer 输入编码数据，为null时每一帧都执行PLC
+     * @param pcm 输出PCM采样，至少 frames * getFrameSamplesCount() 个
+     * @param frames 帧数
+     * @return 0表示成功，1表示至少一帧执行了PLC，-1表示失败
+     */
+    fun decode(inputBuffer: ByteArray?, pcm: IntArray, frames: Int = 1): Int {
+        if (decoderHandle == 0L) {
+            return -1
+        }
+        
+        return decodeInts(decoderHandle, inputBuffer, frameBytes, pcm, frameSamples, frames)
+    }
+    
+    /**
+     * 解码多帧数据为浮点PCM（PCM_FORMAT_FLOAT）
+     * @param inputBuffer 输入编码数据，为null时每一帧都执行PLC
+     * @param pcm 输出PCM采样，至少 frames * getFrameSamplesCount() 个
+     * @param frames 帧数
+     * @return 0表示成功，1表示至少一帧执行了PLC，-1表示失败
+     */
+    fun decode(inputBuffer: ByteArray?, pcm: FloatArray, frames: Int = 1): Int {
+        if (decoderHandle == 0L) {
+            return -1
+        }
+        
+        return decodeFloats(decoderHandle, inputBuffer, frameBytes, pcm, frameSamples, frames)
+    }
+    
     /**
      * 执行丢包隐藏（PLC）
      * @param outputBuffer 输出PCM数据
@@ -200,6 +292,18 @@ class LC3Codec {
                                outputByteCount: Int, outputBuffer: ByteArray): Int
     private external fun decode(decoderHandle: Long, inputBuffer: ByteArray?, inputSize: Int, 
                                outputBuffer: ByteArray, outputSize: Int): Int
+    private external fun encodeShorts(encoderHandle: Long, pcm: ShortArray, frameSamples: Int,
+                                      frames: Int, outputByteCount: Int, outputBuffer: ByteArray): Int
+    private external fun encodeInts(encoderHandle: Long, pcm: IntArray, frameSamples: Int,
+                                    frames: Int, outputByteCount: Int, outputBuffer: ByteArray): Int
+    private external fun encodeFloats(encoderHandle: Long, pcm: FloatArray, frameSamples: Int,
+                                      frames: Int, outputByteCount: Int, outputBuffer: ByteArray): Int
+    private external fun decodeShorts(decoderHandle: Long, inputBuffer: ByteArray?, inputByteCount: Int,
+                                      pcm: ShortArray, frameSamples: Int, frames: Int): Int
+    private external fun decodeInts(decoderHandle: Long, inputBuffer: ByteArray?, inputByteCount: Int,
+                                    pcm: IntArray, frameSamples: Int, frames: Int): Int
+    private external fun decodeFloats(decoderHandle: Long, inputBuffer: ByteArray?, inputByteCount: Int,
+                                      pcm: FloatArray, frameSamples: Int, frames: Int): Int
     private external fun releaseEncoder(encoderHandle: Long)
     private external fun releaseDecoder(decoderHandle: Long)
 }
\ No newline at end of file
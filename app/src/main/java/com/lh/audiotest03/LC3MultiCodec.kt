@@ -0,0 +1,171 @@
+package com.lh.audiotest03
+
+/**
+ * 多声道LC3编解码器的Java封装类
+ * 输入输出均为交织的16位PCM，所有声道在一次JNI调用中完成编解码
+ */
+class LC3MultiCodec {
+    companion object {
+        // 加载本地库
+        init {
+            System.loadLibrary("audiotest03")
+        }
+    }
+
+    // 编码器和解码器句柄
+    private var encoderHandle: Long = 0
+    private var decoderHandle: Long = 0
+
+    // 声道数、单帧采样数（每声道）和每声道编码字节数
+    private var channels: Int = 0
+    private var frameSamples: Int = 0
+    private var frameBytes: Int = 0
+
+    /**
+     * 初始化编码器
+     * @param dtUs 帧长（微秒）
+     * @param srHz 采样率（Hz）
+     * @param channelCount 声道数
+     * @param outputByteCount 每个声道编码后每帧的字节数
+     * @param parallel 是否按声道并行编码
+     * @return 是否成功初始化
+     */
+    fun initEncoder(dtUs: Int, srHz: Int, channelCount: Int, outputByteCount: Int,
+                    parallel: Boolean = false): Boolean {
+        releaseEncoder()
+
+        if (!configure(dtUs, srHz, channelCount, outputByteCount)) {
+            return false
+        }
+
+        encoderHandle = setupEncoder(dtUs, srHz, channelCount, outputByteCount, parallel)
+        return encoderHandle != 0L
+    }
+
+    /**
+     * 初始化解码器
+     * @param dtUs 帧长（微秒）
+     * @param srHz 采样率（Hz）
+     * @param channelCount 声道数
+     * @param outputByteCount 每个声道编码后每帧的字节数
+     * @param parallel 是否按声道并行解码
+     * @return 是否成功初始化
+     */
+    fun initDecoder(dtUs: Int, srHz: Int, channelCount: Int, outputByteCount: Int,
+                    parallel: Boolean = false): Boolean {
+        releaseDecoder()
+
+        if (!configure(dtUs, srHz, channelCount, outputByteCount)) {
+            return false
+        }
+
+        decoderHandle = setupDecoder(dtUs, srHz, channelCount, outputByteCount, parallel)
+        return decoderHandle != 0L
+    }
+
+    /**
+     * 编码多帧交织PCM数据
+     * @param inputBuffer 输入PCM数据，至少 frames * getFrameBytesCount() 字节
+     * @param outputBuffer 输出编码数据，至少 frames * getEncodedBytesCount() 字节
+     * @param frames 帧数
+     * @return 0表示成功，-1表示失败
+     */
+    fun encode(inputBuffer: ByteArray, outputBuffer: ByteArray, frames: Int = 1): Int {
+        if (encoderHandle == 0L) {
+            return -1
+        }
+
+        return encode(encoderHandle, inputBuffer, outputBuffer, frames)
+    }
+
+    /**
+     * 解码多帧数据为交织PCM
+     * @param inputBuffer 输入编码数据，为null时执行PLC（丢包隐藏）
+     * @param outputBuffer 输出PCM数据
+     * @param frames 帧数
+     * @return 0表示成功，1表示执行了PLC，-1表示失败
+     */
+    fun decode(inputBuffer: ByteArray?, outputBuffer: ByteArray, frames: Int = 1): Int {
+        if (decoderHandle == 0L) {
+            return -1
+        }
+
+        return decode(decoderHandle, inputBuffer, outputBuffer, frames)
+    }
+
+    /**
+     * 释放编码器资源
+     */
+    fun releaseEncoder() {
+        if (encoderHandle != 0L) {
+            releaseEncoder(encoderHandle)
+            encoderHandle = 0
+        }
+    }
+
+    /**
+     * 释放解码器资源
+     */
+    fun releaseDecoder() {
+        if (decoderHandle != 0L) {
+            releaseDecoder(decoderHandle)
+            decoderHandle = 0
+        }
+    }
+
+    /**
+     * 释放所有资源
+     */
+    fun release() {
+        releaseEncoder()
+        releaseDecoder()
+    }
+
+    /**
+     * 获取声道数
+     */
+    fun getChannelCount(): Int {
+        return channels
+    }
+
+    /**
+     * 获取每个声道的单帧采样数
+     */
+    fun getFrameSamplesCount(): Int {
+        return frameSamples
+    }
+
+    /**
+     * 获取单帧交织PCM字节数（所有声道，每个采样2字节）
+     */
+    fun getFrameBytesCount(): Int {
+        return frameSamples * channels * 2
+    }
+
+    /**
+     * 获取单帧编码后的字节数（所有声道）
+     */
+    fun getEncodedBytesCount(): Int {
+        return frameBytes * channels
+    }
+
+    private fun configure(dtUs: Int, srHz: Int, channelCount: Int, outputByteCount: Int): Boolean {
+        channels = channelCount
+        frameBytes = outputByteCount
+        frameSamples = getFrameSamples(dtUs, srHz)
+        return channels > 0 && frameSamples > 0
+    }
+
+    // 本地方法
+    private external fun getFrameSamples(dtUs: Int, srHz: Int): Int
+    private external fun setupEncoder(dtUs: Int, srHz: Int, channelCount: Int,
+                                      frameBytes: Int, parallel: Boolean): Long
+    private external fun setupDecoder(dtUs: Int, srHz: Int, channelCount: Int,
+                                      frameBytes: Int, parallel: Boolean): Long
+    private external fun encode(encoderHandle: Long, inputBuffer: ByteArray,
+                                outputBuffer: ByteArray, frames: Int): Int
+    private external fun decode(decoderHandle: Long, inputBuffer: ByteArray?,
+                                outputBuffer: ByteArray, frames: Int): Int
+    private external fun releaseEncoder(encoderHandle: Long)
+    private external fun releaseDecoder(decoderHandle: Long)
+}
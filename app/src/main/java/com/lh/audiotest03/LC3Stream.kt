@@ -0,0 +1,130 @@
+package com.lh.audiotest03
+
+import java.nio.ByteBuffer
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.Job
+import kotlinx.coroutines.NonCancellable
+import kotlinx.coroutines.cancelAndJoin
+import kotlinx.coroutines.flow.Flow
+import kotlinx.coroutines.flow.channelFlow
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.withContext
+
+/**
+ * LC3流式编码接口
+ * 基于Kotlin Flow的薄封装，缓冲池与编码线程均由native层（lc3_stream.cpp）维护
+ */
+object LC3Stream {
+    init {
+        System.loadLibrary("audiotest03")
+    }
+
+    // 默认缓冲块个数与每块帧数
+    const val DEFAULT_POOL_SIZE = 4
+    const val DEFAULT_BATCH_FRAMES = 50
+
+    /**
+     * 将16位单声道PCM数据流编码为LC3数据流
+     *
+     * 输入数据块的大小任意，不必按帧对齐；每收集一次都会创建独立的native编码器。
+     * 输出的每个ByteArray包含若干个连续的编码帧（每帧 outputByteCount 字节），
+     * 末尾不足一帧的PCM数据将被丢弃。
+     *
+     * @param pcm 输入PCM数据流
+     * @param dtUs 帧长（微秒）
+     * @param srHz 采样率（Hz）
+     * @param outputByteCount 编码后每帧的字节数
+     * @param poolSize 缓冲块个数
+     * @param batchFrames 每个缓冲块的帧数，即每次JNI调用处理的帧数
+     * @return 编码后的数据流
+     */
+    fun encode(
+        pcm: Flow<ByteArray>,
+        dtUs: Int,
+        srHz: Int,
+        outputByteCount: Int,
+        poolSize: Int = DEFAULT_POOL_SIZE,
+        batchFrames: Int = DEFAULT_BATCH_FRAMES
+    ): Flow<ByteArray> = channelFlow {
+        val handle = nativeCreate(dtUs, srHz, outputByteCount, poolSize, batchFrames)
+        require(handle != 0L) { "无法创建LC3流式编码器" }
+
+        var producer: Job? = null
+        try {
+            // 直接缓冲区与native缓冲块共享内存
+            val pcmBuffers = Array(poolSize) { nativePcmBuffer(handle, it)!! }
+            val outputBuffers = Array(poolSize) { nativeOutputBuffer(handle, it)!! }
+            val blockBytes = pcmBuffers[0].capacity()
+            val framePcmBytes = blockBytes / batchFrames
+
+            // 生产者：填充缓冲块并提交给native编码线程
+            producer = launch(Dispatchers.IO) {
+                var index = -1
+                var filled = 0
+                try {
+                    pcm.collect { chunk ->
+                        var offset = 0
+                        while (offset < chunk.size) {
+                            if (index < 0) {
+                                index = nativeAcquire(handle)
+                                if (index < 0) throw CancellationException("LC3流已关闭")
+                                pcmBuffers[index].clear()
+                                filled = 0
+                            }
+
+                            val n = minOf(chunk.size - offset, blockBytes - filled)
+                            pcmBuffers[index].put(chunk, offset, n)
+                            filled += n
+                            offset += n
+
+                            if (filled == blockBytes) {
+                                nativeSubmit(handle, index, batchFrames)
+                                index = -1
+                            }
+                        }
+                    }
+
+                    if (index >= 0) nativeSubmit(handle, index, filled / framePcmBytes)
+                } finally {
+                    nativeFinish(handle)
+                }
+            }
+
+            // 消费者：取出编码完成的缓冲块并发送
+            withContext(Dispatchers.IO) {
+                while (true) {
+                    val index = nativeTake(handle)
+                    if (index < 0) break
+
+                    val output = ByteArray(nativeFrames(handle, index) * outputByteCount)
+                    outputBuffers[index].clear()
+                    outputBuffers[index].get(output)
+                    nativeRelease(handle, index)
+
+                    send(output)
+                }
+            }
+        } finally {
+            withContext(NonCancellable) {
+                nativeClose(handle)
+                producer?.cancelAndJoin()
+                nativeDestroy(handle)
+            }
+        }
+    }
+
+    // 本地方法
+    private external fun nativeCreate(dtUs: Int, srHz: Int, frameBytes: Int,
+                                      poolSize: Int, batchFrames: Int): Long
+    private external fun nativePcmBuffer(handle: Long, index: Int): ByteBuffer?
+    private external fun nativeOutputBuffer(handle: Long, index: Int): ByteBuffer?
+    private external fun nativeAcquire(handle: Long): Int
+    private external fun nativeSubmit(handle: Long, index: Int, frames: Int): Boolean
+    private external fun nativeFinish(handle: Long)
+    private external fun nativeTake(handle: Long): Int
+    private external fun nativeFrames(handle: Long, index: Int): Int
+    private external fun nativeRelease(handle: Long, index: Int)
+    private external fun nativeClose(handle: Long)
+    private external fun nativeDestroy(handle: Long)
+}
@@ -2,6 +2,7 @@ package com.lh.audiotest03.utils
 
 import android.util.Log
 import com.lh.audiotest03.LC3Codec
+import com.lh.audiotest03.LC3MultiCodec
 import java.io.ByteArrayInputStream
 import java.io.File
 import java.io.FileOutputStream
@@ -14,6 +15,9 @@ class LC3Utils {
     companion object {
         private const val TAG = "LC3Utils"
         
+        // 多声道编解码时每次JNI调用处理的帧数
+        private const val MULTI_CHANNEL_BATCH_FRAMES = 50
+        
         /**
          * 将WAV文件编码为LC3格式
          * 
@@ -21,7 +25,7 @@ class LC3Utils {
          * @param encodedFile 输出LC3编码文件
          * @param frameDurationUs 帧长（微秒）
          * @param sampleRate 采样率（Hz）
-         * @param outputByteCount 编码后每帧的字节数
+         * @param outputByteCount 编码后每帧的字节数（多声道时为每个声道的字节数）
          * @param lc3Codec LC3编解码器实例
          * @param logger 日志记录回调
          * @return 是否成功编码
@@ -71,11 +75,11 @@ class LC3Utils {
                 logger?.invoke("- 位深度: ${wavData.bitsPerSample} 位")
                 logger?.invoke("- PCM数据大小: ${wavData.pcmData.size} 字节")
                 
-                // 检查声道数，LC3编码器目前只支持单声道
+                // 多声道音频使用多声道编码器，所有声道在一次调用中完成编码
                 if (wavData.channels != 1) {
-                    logger?.invoke("错误: LC3编码器目前只支持单声道音频，当前声道数: ${wavData.channels}")
                     lc3Codec.releaseEncoder()
-                    return false
+                    return encodeMultiChannel(wavData, encodedFile, frameDurationUs, sampleRate,
+                        outputByteCount, logger)
                 }
                 
                 // 创建输入流从PCM数据读取
@@ -199,7 +203,7 @@ class LC3Utils {
          * @param wavFile 输出WAV文件
          * @param frameDurationUs 帧长（微秒）
          * @param sampleRate 采样率（Hz）
-         * @param outputByteCount 编码后每帧的字节数
+         * @param outputByteCount 编码后每帧的字节数（多声道时为每个声道的字节数）
          * @param channelConfig 声道配置
          * @param audioFormat 音频格式
          * @param lc3Codec LC3编解码器实例
@@ -224,6 +228,13 @@ class LC3Utils {
                 return false
             }
             
+            // 多声道音频使用多声道解码器
+            val channels = Integer.bitCount(channelConfig)
+            if (channels != 1) {
+                return decodeMultiChannel(encodedFile, wavFile, frameDurationUs, sampleRate,
+                    outputByteCount, channels, channelConfig, audioFormat, logger)
+            }
+            
             // 初始化LC3解码器
             if (!lc3Codec.initDecoder(frameDurationUs, sampleRate, outputByteCount)) {
                 logger?.invoke("错误: 无法初始化LC3解码器")
@@ -339,5 +350,139 @@ class LC3Utils {
                 return false
             }
         }
+
+        /**
+         * 使用多声道编码器将交织PCM数据编码为LC3格式
+         * 每帧依次写入各声道的编码数据
+         */
+        private fun encodeMultiChannel(
+            wavData: WavUtils.Companion.WavData,
+            encodedFile: File,
+            frameDurationUs: Int,
+            sampleRate: Int,
+            outputByteCount: Int,
+            logger: ((String) -> Unit)?
+        ): Boolean {
+            val codec = LC3MultiCodec()
+            if (!codec.initEncoder(frameDurationUs, sampleRate, wavData.channels, outputByteCount,
+                    parallel = true)) {
+                logger?.invoke("错误: 无法初始化多声道LC3编码器，声道数: ${wavData.channels}")
+                return false
+            }
+            
+            logger?.invoke("使用多声道编码器，声道数: ${wavData.channels}")
+            
+            try {
+                val framePcmBytes = codec.getFrameBytesCount()
+                val frameEncodedBytes = codec.getEncodedBytesCount()
+                val totalFrames = wavData.pcmData.size / framePcmBytes
+                
+                val inputBuffer = ByteArray(framePcmBytes * MULTI_CHANNEL_BATCH_FRAMES)
+                val encodedBuffer = ByteArray(frameEncodedBytes * MULTI_CHANNEL_BATCH_FRAMES)
+                
+                if (encodedFile.exists()) encodedFile.delete()
+                FileOutputStream(encodedFile).use { output ->
+                    var frame = 0
+                    while (frame < totalFrames) {
+                        val frames = minOf(MULTI_CHANNEL_BATCH_FRAMES, totalFrames - frame)
+                        System.arraycopy(wavData.pcmData, frame * framePcmBytes,
+                            inputBuffer, 0, frames * framePcmBytes)
+                        
+                        val encodeResult = codec.encode(inputBuffer, encodedBuffer, frames)
+                        if (encodeResult < 0) {
+                            logger?.invoke("警告: 帧 $frame 起的 $frames 帧编码失败，错误码: $encodeResult")
+                        } else {
+                            output.write(encodedBuffer, 0, frames * frameEncodedBytes)
+                        }
+                        
+                        frame += frames
+                    }
+                }
+                
+                logger?.invoke("编码完成")
+                logger?.invoke("处理帧数: $totalFrames")
+                logger?.invoke("编码文件大小: ${encodedFile.length()} 字节")
+                
+                return totalFrames > 0 && encodedFile.length() > 0
+                
+            } catch (e: IOException) {
+                logger?.invoke("错误: 处理文件时发生错误: ${e.message}")
+                Log.e(TAG, "处理文件时发生错误", e)
+                return false
+            } finally {
+                codec.release()
+            }
+        }
+        
+        /**
+         * 使用多声道解码器将LC3编码文件解码为WAV文件
+         */
+        private fun decodeMultiChannel(
+            encodedFile: File,
+            wavFile: File,
+            frameDurationUs: Int,
+            sampleRate: Int,
+            outputByteCount: Int,
+            channels: Int,
+            channelConfig: Int,
+            audioFormat: Int,
+            logger: ((String) -> Unit)?
+        ): Boolean {
+            val codec = LC3MultiCodec()
+            if (!codec.initDecoder(frameDurationUs, sampleRate, channels, outputByteCount,
+                    parallel = true)) {
+                logger?.invoke("错误: 无法初始化多声道LC3解码器，声道数: $channels")
+                return false
+            }
+            
+            logger?.invoke("使用多声道解码器，声道数: $channels")
+            
+            try {
+                val encodedData = encodedFile.readBytes()
+                val framePcmBytes = codec.getFrameBytesCount()
+                val frameEncodedBytes = codec.getEncodedBytesCount()
+                val totalFrames = encodedData.size / frameEncodedBytes
+                
+                val encodedBuffer = ByteArray(frameEncodedBytes * MULTI_CHANNEL_BATCH_FRAMES)
+                val outputBuffer = ByteArray(framePcmBytes * MULTI_CHANNEL_BATCH_FRAMES)
+                
+                val tempPcmFile = File(wavFile.parent, "temp_decoded.pcm")
+                if (tempPcmFile.exists()) tempPcmFile.delete()
+                FileOutputStream(tempPcmFile).use { output ->
+                    var frame = 0
+                    while (frame < totalFrames) {
+                        val frames = minOf(MULTI_CHANNEL_BATCH_FRAMES, totalFrames - frame)
+                        System.arraycopy(encodedData, frame * frameEncodedBytes,
+                            encodedBuffer, 0, frames * frameEncodedBytes)
+                        
+                        val decodeResult = codec.decode(encodedBuffer, outputBuffer, frames)
+                        if (decodeResult < 0) {
+                            logger?.invoke("解码错误，帧 $frame 起的 $frames 帧, 错误码: $decodeResult")
+                        } else {
+                            output.write(outputBuffer, 0, frames * framePcmBytes)
+                        }
+                        
+                        frame += frames
+                    }
+                }
+                
+                if (wavFile.exists()) wavFile.delete()
+                WavUtils.convertPcmToWav(tempPcmFile, wavFile, sampleRate, channelConfig, audioFormat, logger)
+                tempPcmFile.delete()
+                
+                logger?.invoke("LC3到WAV解码完成")
+                logger?.invoke("处理帧数: $totalFrames")
+                logger?.invoke("解码文件大小: ${wavFile.length()} 字节")
+                
+                return true
+                
+            } catch (e: IOException) {
+                logger?.invoke("错误: 处理文件时发生错误: ${e.message}")
+                Log.e(TAG, "处理文件时发生错误", e)
+                return false
+            } finally {
+                codec.release()
+            }
+        }
     }
 }
\ No newline at end of file
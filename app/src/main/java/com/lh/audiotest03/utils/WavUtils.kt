@@ -170,7 +170,7 @@ class WavUtils {
             logger: ((String) -> Unit)? = null
         ) {
             try {
-                val channels = if (channelConfig == AudioFormat.CHANNEL_IN_MONO) 1 else 2
+                val channels = Integer.bitCount(channelConfig)
                 val bitsPerSample = if (audioFormat == AudioFormat.ENCODING_PCM_16BIT) 16 else 8
                 
                 val pcmData = pcmFile.readBytes()